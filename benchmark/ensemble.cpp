@@ -0,0 +1,76 @@
+// Measures the throughput of world ensemble evaluation versus thread count.
+//
+// Run with:
+//   bazel run -c opt //benchmark:ensemble
+
+#include "turtle/checks.hpp"
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/world.hpp"
+#include "turtle/world_ensemble.hpp"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using N = turtle::frame<"N", double, turtle::checks::none>;
+using A = turtle::frame<"A", double, turtle::checks::none>;
+using B = turtle::frame<"B", double, turtle::checks::none>;
+using C = turtle::frame<"C", double, turtle::checks::none>;
+
+using turtle::orientation;
+
+constexpr auto members = std::size_t{1'000'000};
+constexpr auto repetitions = 10;
+
+}  // namespace
+
+auto main() -> int
+{
+    using W = decltype(turtle::world{
+        orientation<N, A>{0.1, N::z},
+        orientation<A, B>{0.2, A::x},
+        orientation<N, C>{0.3, N::y},
+    });
+
+    auto ensemble = turtle::world_ensemble<W>{members};
+
+    auto rng = std::mt19937_64{};
+    auto noise = std::normal_distribution<double>{0., 0.01};
+    for (auto& ori : ensemble.get<N, A>()) {
+        ori = orientation<N, A>{0.1 + noise(rng), N::z};
+    }
+    for (auto& ori : ensemble.get<A, B>()) {
+        ori = orientation<A, B>{0.2 + noise(rng), A::x};
+    }
+
+    auto out = std::vector<orientation<C, B>>(members);
+
+    fmt::print("{} members\n", members);
+    fmt::print("{:>8}{:>16}\n", "threads", "members/s");
+
+    const auto max_threads = std::max(
+        std::size_t{1}, std::size_t{std::thread::hardware_concurrency()});
+
+    for (auto threads = std::size_t{1}; threads <= max_threads; threads *= 2) {
+        auto best = std::chrono::duration<double>::max();
+
+        for (auto r = 0; r != repetitions; ++r) {
+            const auto start = std::chrono::steady_clock::now();
+            ensemble.express<C, B>(out, threads);
+            best = std::min<std::chrono::duration<double>>(
+                best, std::chrono::steady_clock::now() - start);
+        }
+
+        fmt::print("{:>8}{:>16.3g}\n",
+                   threads,
+                   static_cast<double>(members) / best.count());
+    }
+}
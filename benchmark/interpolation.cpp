@@ -0,0 +1,131 @@
+// Compares the speed and accuracy of batch quaternion interpolation.
+//
+// Run with:
+//   bazel run -c opt //benchmark:interpolation
+
+#include "turtle/checks.hpp"
+#include "turtle/frame.hpp"
+#include "turtle/quaternion.hpp"
+#include "turtle/quaternion_span.hpp"
+#include "turtle/vector.hpp"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// random axes may exceed the unit norm tolerance by a few ULPs
+using N = turtle::frame<"N", double, turtle::checks::none>;
+using quaternion = turtle::quaternion<double>;
+
+constexpr auto count = std::size_t{1} << 16U;
+constexpr auto repetitions = 50;
+
+struct soa {
+    std::vector<double> w = std::vector<double>(count);
+    std::vector<double> x = std::vector<double>(count);
+    std::vector<double> y = std::vector<double>(count);
+    std::vector<double> z = std::vector<double>(count);
+
+    auto view() -> turtle::quaternion_span<double> { return {w, x, y, z}; }
+};
+
+// Generates unit quaternions `p` within `max_angle` of each `q`
+auto make_inputs(double max_angle, soa& q, soa& p, std::vector<double>& t)
+{
+    auto rng = std::mt19937_64{};
+    auto normal = std::normal_distribution<double>{};
+    auto uniform = std::uniform_real_distribution<double>{};
+
+    const auto axis = [&] {
+        return normalized(N::vector{normal(rng), normal(rng), normal(rng)});
+    };
+
+    for (auto i = std::size_t{}; i != count; ++i) {
+        const auto qi = quaternion{std::numbers::pi * uniform(rng), axis()};
+        const auto dq = quaternion{max_angle * uniform(rng), axis()};
+
+        q.view().set(i, qi);
+        p.view().set(i, dq * qi);
+        t[i] = uniform(rng);
+    }
+}
+
+// Angle of the rotation between two unit quaternions
+auto angle_between(const quaternion& q, const quaternion& p) -> double
+{
+    const auto dot =
+        q.w() * p.w() + q.x() * p.x() + q.y() * p.y() + q.z() * p.z();
+    const auto s = (dot < 0.) ? -1. : 1.;
+
+    const auto diff = quaternion{
+        q.w() - s * p.w(), q.x() - s * p.x(), q.y() - s * p.y(),
+        q.z() - s * p.z()};
+    const auto sum = quaternion{
+        q.w() + s * p.w(), q.x() + s * p.x(), q.y() + s * p.y(),
+        q.z() + s * p.z()};
+
+    return 4. * std::atan2(std::sqrt(diff.squared_norm()),
+                           std::sqrt(sum.squared_norm()));
+}
+
+template <class Interpolate>
+auto run(std::string_view name,
+         soa& q,
+         soa& p,
+         const std::vector<double>& t,
+         soa& exact,
+         Interpolate interpolate)
+{
+    auto out = soa{};
+    auto best = std::chrono::nanoseconds::max();
+
+    for (auto r = 0; r != repetitions; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        interpolate(q.view(), p.view(), t, out.view());
+        best = std::min(best, std::chrono::steady_clock::now() - start);
+    }
+
+    auto max_error = 0.;
+    for (auto i = std::size_t{}; i != count; ++i) {
+        max_error = std::max(
+            max_error, angle_between(exact.view()[i], out.view()[i]));
+    }
+
+    fmt::print("  {:<12}{:>10.2f} ns/op{:>14.3g} rad\n",
+               name,
+               static_cast<double>(best.count()) / count,
+               max_error);
+}
+
+}  // namespace
+
+auto main() -> int
+{
+    for (auto max_angle : {0.01, 0.1, 1., std::numbers::pi}) {
+        auto q = soa{};
+        auto p = soa{};
+        auto t = std::vector<double>(count);
+        make_inputs(max_angle, q, p, t);
+
+        auto exact = soa{};
+        slerp(q.view(), p.view(), t, exact.view());
+
+        fmt::print("max arc angle {} rad, {} quaternions\n", max_angle, count);
+        fmt::print("  {:<12}{:>16}{:>18}\n", "", "time", "max error");
+
+        run("slerp", q, p, t, exact, [](auto... args) { slerp(args...); });
+        run("nlerp", q, p, t, exact, [](auto... args) { nlerp(args...); });
+        run("fast_slerp", q, p, t, exact, [](auto... args) {
+            fast_slerp(args...);
+        });
+    }
+}
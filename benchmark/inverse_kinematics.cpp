@@ -0,0 +1,256 @@
+// Compares the speed of analytic and finite difference Jacobians of serial
+// chains, and the speed of inverse kinematics solves built on them.
+//
+// Each chain is a sequence of unit links connected by revolute joints with
+// alternating axes. The analytic Jacobian is obtained from a single sweep of
+// the frame tree, while the forward difference Jacobian evaluates the tip
+// position once per joint and once as a reference.
+//
+// Chains are limited to 16 joints, as the velocity type of a world point has an
+// alternative for every pair of frames and deeper chains exceed the default
+// template instantiation depth.
+//
+// Run with:
+//   bazel run -c opt //benchmark:inverse_kinematics
+
+#include "turtle/frame.hpp"
+#include "turtle/inverse_kinematics.hpp"
+#include "turtle/jacobian.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/point.hpp"
+#include "turtle/world.hpp"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr auto count = std::size_t{1} << 8U;
+constexpr auto repetitions = 10;
+
+template <std::size_t I>
+constexpr char link_name[] = {'L',
+                               static_cast<char>('0' + I / 10),
+                               static_cast<char>('0' + I % 10),
+                               '\0'};
+
+template <std::size_t I>
+using link = turtle::frame<link_name<I>>;
+
+template <std::size_t I>
+using joint = turtle::revolute<link<I>, link<I + 1>>;
+
+using base = link<0>;
+
+}  // namespace
+
+// the product of two random rotations may round beyond the unit norm
+// tolerance, so every composition is renormalized
+template <>
+struct turtle::renormalization_period<base>
+    : std::integral_constant<std::size_t, 1> {};
+
+namespace {
+
+template <std::size_t I>
+constexpr auto axis()
+{
+    return I % 2 == 0 ? link<I>::z : link<I>::y;
+}
+
+template <std::size_t Depth>
+struct chain {
+    using N = base;
+
+    template <std::size_t... Is>
+    static auto make_world(const std::array<double, Depth>& q,
+                           std::index_sequence<Is...>)
+    {
+        return turtle::world{
+            turtle::orientation<link<Is>, link<Is + 1>>{q[Is], axis<Is>()}
+                .with(typename link<Is>::position{
+                    Is == 0 ? 0. : 1., 0., 0.})...};
+    }
+
+    static auto make_world(const std::array<double, Depth>& q)
+    {
+        return make_world(q, std::make_index_sequence<Depth>{});
+    }
+
+    using world = decltype(make_world({}));
+    using point = typename world::point;
+
+    static constexpr auto tip = [] {
+        return point{typename link<Depth>::position{1., 0., 0.},
+                     typename link<Depth>::velocity{}};
+    };
+
+    template <class F, std::size_t... Is>
+    static auto apply(F f, std::index_sequence<Is...>)
+    {
+        return f(joint<Is>{axis<Is>()}...);
+    }
+
+    template <class F>
+    static auto apply(F f)
+    {
+        return apply(f, std::make_index_sequence<Depth>{});
+    }
+};
+
+using columns = std::vector<std::array<double, 3>>;
+
+template <class Chain>
+auto analytic(const typename Chain::world& w) -> columns
+{
+    const auto jac = Chain::apply([&w](const auto&... joints) {
+        return turtle::jacobian<typename Chain::N>(w, Chain::tip(), joints...);
+    });
+
+    auto out = columns{};
+    for (const auto& col : jac.position) {
+        out.push_back({col.x(), col.y(), col.z()});
+    }
+    return out;
+}
+
+template <class Chain>
+auto forward_difference(const typename Chain::world& w) -> columns
+{
+    constexpr auto h = 1e-7;
+    using N = typename Chain::N;
+
+    const auto p0 = Chain::tip().template position<N>(w);
+
+    auto out = columns{};
+    Chain::apply([&](const auto&... joints) {
+        const auto difference = [&]<class P, class C>(
+                                    const turtle::revolute<P, C>& j) {
+            auto moved = w;
+            moved.template get<P, C>() =
+                j.advanced(w.template get<P, C>(), h);
+
+            const auto dp = (Chain::tip().template position<N>(moved) - p0) / h;
+            out.push_back({dp.x(), dp.y(), dp.z()});
+        };
+        (difference(joints), ...);
+        return 0;
+    });
+    return out;
+}
+
+template <class F>
+auto best_of(F f)
+{
+    auto best = std::chrono::nanoseconds::max();
+    for (auto r = 0; r != repetitions; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::steady_clock::now() - start);
+    }
+    return static_cast<double>(best.count()) / count;
+}
+
+template <std::size_t Depth>
+auto run(std::mt19937_64& rng)
+{
+    using Chain = chain<Depth>;
+    using N = typename Chain::N;
+
+    auto uniform = std::uniform_real_distribution<double>{-1., 1.};
+    const auto random_angles = [&] {
+        auto q = std::array<double, Depth>{};
+        std::generate(q.begin(), q.end(), [&] { return uniform(rng); });
+        return q;
+    };
+
+    auto worlds = std::vector<typename Chain::world>{};
+    auto targets = std::vector<turtle::position<N>>{};
+    for (auto k = std::size_t{}; k != count; ++k) {
+        worlds.push_back(Chain::make_world(random_angles()));
+        targets.push_back(Chain::tip().template position<N>(
+            Chain::make_world(random_angles())));
+    }
+
+    auto exact = std::vector<columns>(count);
+    auto numeric = std::vector<columns>(count);
+
+    const auto t_analytic = best_of([&] {
+        std::transform(
+            worlds.begin(), worlds.end(), exact.begin(), analytic<Chain>);
+    });
+    const auto t_numeric = best_of([&] {
+        std::transform(worlds.begin(),
+                       worlds.end(),
+                       numeric.begin(),
+                       forward_difference<Chain>);
+    });
+
+    auto max_error = 0.;
+    for (auto k = std::size_t{}; k != count; ++k) {
+        for (auto i = std::size_t{}; i != Depth; ++i) {
+            for (auto j = std::size_t{}; j != 3; ++j) {
+                max_error = std::max(
+                    max_error, std::abs(exact[k][i][j] - numeric[k][i][j]));
+            }
+        }
+    }
+
+    auto converged = std::size_t{};
+    auto iterations = std::size_t{};
+    const auto t_solve = best_of([&] {
+        converged = 0;
+        iterations = 0;
+        for (auto k = std::size_t{}; k != count; ++k) {
+            auto w = worlds[k];
+            const auto result =
+                Chain::apply([&](const auto&... joints) {
+                    return turtle::solve_position<N>(w,
+                                                     Chain::tip(),
+                                                     targets[k],
+                                                     turtle::ik_options{},
+                                                     joints...);
+                });
+            converged += std::size_t{result.converged};
+            iterations += result.iterations;
+        }
+    });
+
+    fmt::print("{} joints\n", Depth);
+    fmt::print("  {:<20}{:>10.2f} ns/op\n", "analytic jacobian", t_analytic);
+    fmt::print("  {:<20}{:>10.2f} ns/op{:>14.3g}\n",
+               "forward difference",
+               t_numeric,
+               max_error);
+    fmt::print("  {:<20}{:>10.2f} ns/op{:>8} / {} converged, {:.1f} "
+               "iterations\n",
+               "solve position",
+               t_solve,
+               converged,
+               count,
+               static_cast<double>(iterations) / count);
+}
+
+}  // namespace
+
+auto main() -> int
+{
+    auto rng = std::mt19937_64{};
+
+    fmt::print("jacobians and position solves of {} serial chains\n", count);
+    fmt::print("  {:<20}{:>16}{:>18}\n", "", "time", "max error");
+
+    run<4>(rng);
+    run<8>(rng);
+    run<16>(rng);
+}
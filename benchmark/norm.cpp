@@ -0,0 +1,169 @@
+// Compares the speed of the `safe` and `fast` numerics policies on workloads
+// dominated by `norm` and `normalized`.
+//
+// The axis workload extracts the rotation axis and angle of many orientations
+// with `orientation::axis()` and `orientation::angle()`. The point workload
+// expresses points fixed in a leaf frame in the root frame of a world and
+// calculates their range and bearing. The normalize workload normalizes an
+// array of vectors and shows the difference without other work.
+//
+// Run with:
+//   bazel run -c opt //benchmark:norm
+
+#include "turtle/frame.hpp"
+#include "turtle/numerics.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/point.hpp"
+#include "turtle/vector_ops.hpp"
+#include "turtle/world.hpp"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <numbers>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr auto count = std::size_t{1} << 14U;
+constexpr auto repetitions = 50;
+
+// random axes may exceed the unit norm tolerance by a few ULPs
+template <class Numerics>
+struct frames {
+    using N = turtle::frame<"N", double, turtle::checks::none, Numerics>;
+    using A = turtle::frame<"A", double, turtle::checks::none, Numerics>;
+    using B = turtle::frame<"B", double, turtle::checks::none, Numerics>;
+};
+
+template <class F>
+auto best_of(F f)
+{
+    auto best = std::chrono::nanoseconds::max();
+    for (auto r = 0; r != repetitions; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::steady_clock::now() - start);
+    }
+    return static_cast<double>(best.count()) / count;
+}
+
+template <class Numerics>
+auto axis_workload() -> double
+{
+    using N = typename frames<Numerics>::N;
+    using A = typename frames<Numerics>::A;
+
+    auto rng = std::mt19937_64{};
+    auto normal = std::normal_distribution<double>{};
+    auto uniform = std::uniform_real_distribution<double>{};
+
+    auto oris = std::vector<turtle::orientation<N, A>>{};
+    for (auto i = std::size_t{}; i != count; ++i) {
+        oris.emplace_back(
+            std::numbers::pi * uniform(rng),
+            normalized(
+                typename N::vector{normal(rng), normal(rng), normal(rng)}));
+    }
+
+    auto axes = std::vector<typename N::vector>(count);
+    auto angles = std::vector<double>(count);
+
+    return best_of([&] {
+        for (auto i = std::size_t{}; i != count; ++i) {
+            axes[i] = oris[i].axis();
+            angles[i] = oris[i].angle();
+        }
+    });
+}
+
+template <class Numerics>
+auto point_workload() -> double
+{
+    using N = typename frames<Numerics>::N;
+    using A = typename frames<Numerics>::A;
+    using B = typename frames<Numerics>::B;
+
+    const auto w = turtle::world{
+        turtle::orientation<N, A>{0.3, N::z}.with(
+            typename N::position{1., 2., 0.}),
+        turtle::orientation<A, B>{-1.1, A::x}.with(
+            typename A::position{0., 0., 0.5}),
+    };
+    using P = typename decltype(w)::point;
+
+    auto rng = std::mt19937_64{};
+    auto normal = std::normal_distribution<double>{};
+
+    auto points = std::vector<P>{};
+    for (auto i = std::size_t{}; i != count; ++i) {
+        points.emplace_back(
+            typename B::position{normal(rng), normal(rng), normal(rng)},
+            typename B::velocity{});
+    }
+
+    auto ranges = std::vector<double>(count);
+    auto bearings = std::vector<typename N::vector>(count);
+
+    return best_of([&] {
+        for (auto i = std::size_t{}; i != count; ++i) {
+            const auto r = std::bit_cast<typename N::vector>(
+                points[i].template position<N>(w));
+            ranges[i] = norm(r);
+            bearings[i] = normalized(r);
+        }
+    });
+}
+
+template <class Numerics>
+auto normalize_workload() -> double
+{
+    using N = typename frames<Numerics>::N;
+
+    auto rng = std::mt19937_64{};
+    auto normal = std::normal_distribution<double>{};
+
+    auto in = std::vector<typename N::vector>{};
+    for (auto i = std::size_t{}; i != count; ++i) {
+        in.emplace_back(normal(rng), normal(rng), normal(rng));
+    }
+
+    auto out = std::vector<typename N::vector>(count);
+
+    return best_of([&] {
+        for (auto i = std::size_t{}; i != count; ++i) {
+            out[i] = normalized(in[i]);
+        }
+    });
+}
+
+template <class Workload>
+auto run(std::string_view name, Workload workload)
+{
+    const auto safe = workload.template operator()<turtle::numerics::safe>();
+    const auto fast = workload.template operator()<turtle::numerics::fast>();
+
+    fmt::print("  {:<12}{:>10.2f} ns/op{:>10.2f} ns/op{:>10.2f}x\n",
+               name,
+               safe,
+               fast,
+               safe / fast);
+}
+
+}  // namespace
+
+auto main() -> int
+{
+    fmt::print("{} samples\n", count);
+    fmt::print("  {:<12}{:>16}{:>16}{:>11}\n", "", "safe", "fast", "speedup");
+
+    run("axis", []<class Numerics>() { return axis_workload<Numerics>(); });
+    run("point", []<class Numerics>() { return point_workload<Numerics>(); });
+    run("normalize",
+        []<class Numerics>() { return normalize_workload<Numerics>(); });
+}
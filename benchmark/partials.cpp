@@ -0,0 +1,192 @@
+// Compares the accuracy and time of partial velocities calculated with dual
+// numbers and with finite differences.
+//
+// Partial velocities of the rolling disc mass center with respect to the
+// generalized speeds are obtained from a single evaluation with dual numbers,
+// or from one evaluation per generalized speed and a reference evaluation with
+// forward differences. Dual numbers are exact to rounding, but each of their
+// operations also updates every partial, and the dual evaluation takes longer
+// than the forward differences.
+//
+// Run with:
+//   bazel run -c opt //benchmark:partials
+
+#include "turtle/dual.hpp"
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/point.hpp"
+#include "turtle/world.hpp"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+constexpr auto speeds = std::size_t{3};
+constexpr auto count = std::size_t{1} << 12U;
+constexpr auto repetitions = 20;
+
+using partials = std::array<std::array<double, 3>, speeds>;
+
+template <class T>
+using inertial = turtle::frame<"N", T>;
+
+}  // namespace
+
+// the product of random rotations may round beyond the unit norm tolerance,
+// so every composition is renormalized
+template <class T>
+struct turtle::renormalization_period<inertial<T>>
+    : std::integral_constant<std::size_t, 1> {};
+
+namespace {
+
+struct state {
+    std::array<double, 3> q;
+    std::array<double, speeds> u;
+};
+
+template <class T>
+auto disc_velocity(const state& s, const std::array<T, speeds>& u)
+{
+    using N = inertial<T>;
+    using Y = turtle::frame<"Y", T>;
+    using L = turtle::frame<"L", T>;
+    using R = turtle::frame<"R", T>;
+
+    const auto w = turtle::world{
+        turtle::orientation<N, Y>{T{s.q[0]}, N::z},
+        turtle::orientation<Y, L>{T{s.q[1]}, Y::x},
+        turtle::orientation<L, R>{T{s.q[2]}, L::y}.with(
+            typename L::velocity{u[0], u[1], u[2]}),
+    };
+
+    using P = typename decltype(w)::point;
+    const auto dmc = P{typename L::position{T{}, T{}, T{1}},
+                       typename R::velocity{}};
+
+    return dmc.template velocity<N>(w);
+}
+
+auto dual_partials(const state& s) -> partials
+{
+    using dual = turtle::dual<double, speeds>;
+
+    auto u = std::array<dual, speeds>{};
+    for (auto i = std::size_t{}; i != speeds; ++i) {
+        u[i] = dual::variable(s.u[i], i);
+    }
+
+    const auto v = disc_velocity(s, u);
+
+    auto out = partials{};
+    for (auto i = std::size_t{}; i != speeds; ++i) {
+        out[i] = {v.x().partial(i), v.y().partial(i), v.z().partial(i)};
+    }
+    return out;
+}
+
+auto finite_difference_partials(const state& s) -> partials
+{
+    constexpr auto h = 1e-7;
+
+    const auto v0 = disc_velocity(s, s.u);
+
+    auto out = partials{};
+    for (auto i = std::size_t{}; i != speeds; ++i) {
+        auto u = s.u;
+        u[i] += h;
+
+        const auto dv = (disc_velocity(s, u) - v0) / h;
+        out[i] = {dv.x(), dv.y(), dv.z()};
+    }
+    return out;
+}
+
+template <class Partials>
+auto run(std::string_view name,
+         const std::vector<state>& states,
+         const std::vector<partials>& exact,
+         Partials calculate)
+{
+    auto out = std::vector<partials>(states.size());
+    auto best = std::chrono::nanoseconds::max();
+
+    for (auto r = 0; r != repetitions; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        std::transform(states.begin(), states.end(), out.begin(), calculate);
+        best = std::min(best, std::chrono::steady_clock::now() - start);
+    }
+
+    auto max_error = 0.;
+    for (auto k = std::size_t{}; k != states.size(); ++k) {
+        for (auto i = std::size_t{}; i != speeds; ++i) {
+            for (auto j = std::size_t{}; j != 3; ++j) {
+                max_error = std::max(
+                    max_error, std::abs(exact[k][i][j] - out[k][i][j]));
+            }
+        }
+    }
+
+    fmt::print("  {:<20}{:>10.2f} ns/op{:>14.3g}\n",
+               name,
+               static_cast<double>(best.count()) / count,
+               max_error);
+}
+
+// Partial velocities of the disc mass center, which is 1 unit from the
+// contact point along the lean axis
+auto analytic_partials(const state& s) -> partials
+{
+    const auto c1 = std::cos(s.q[0]);
+    const auto s1 = std::sin(s.q[0]);
+    const auto c2 = std::cos(s.q[1]);
+    const auto s2 = std::sin(s.q[1]);
+
+    // axes of the lean frame expressed in the inertial frame
+    const auto lx = std::array{c1, s1, 0.};
+    const auto ly = std::array{-s1 * c2, c1 * c2, s2};
+    const auto lz = std::array{s1 * s2, -c1 * s2, c2};
+
+    // v = (u1 lx + u2 ly + u3 lz) × lz
+    const auto cross_lz = [&lz](const std::array<double, 3>& a) {
+        return std::array{a[1] * lz[2] - a[2] * lz[1],
+                          a[2] * lz[0] - a[0] * lz[2],
+                          a[0] * lz[1] - a[1] * lz[0]};
+    };
+
+    return {cross_lz(lx), cross_lz(ly), cross_lz(lz)};
+}
+
+}  // namespace
+
+auto main() -> int
+{
+    auto rng = std::mt19937_64{};
+    auto uniform = std::uniform_real_distribution<double>{-1., 1.};
+
+    auto states = std::vector<state>(count);
+    for (auto& s : states) {
+        s = {{uniform(rng), uniform(rng), uniform(rng)},
+             {uniform(rng), uniform(rng), uniform(rng)}};
+    }
+
+    auto exact = std::vector<partials>(count);
+    std::transform(
+        states.begin(), states.end(), exact.begin(), analytic_partials);
+
+    fmt::print("{} partial velocities of {} states\n", speeds, count);
+    fmt::print("  {:<20}{:>16}{:>18}\n", "", "time", "max error");
+
+    run("dual", states, exact, dual_partials);
+    run("finite difference", states, exact, finite_difference_partials);
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "fwd.hpp"
+#include "vector.hpp"
+#include "vector_interface.hpp"
+
+#include "fmt/format.h"
+#include "fmt/ranges.h"
+
+#include <bit>
+#include <concepts>
+#include <utility>
+
+namespace turtle {
+
+/// @brief An acceleration vector
+/// @tparam B Observation frame
+/// @tparam E Expression frame
+template <kinematic::frame B, kinematic::frame E = B>
+requires std::same_as<typename B::scalar, typename E::scalar>
+struct acceleration
+    : vector_interface<typename B::scalar, acceleration<B, E>> {
+    /// Reference frame in which the acceleration is observed in
+    using observation_frame = B;
+    /// Reference frame in which the acceleration is expressed in
+    using expression_frame = E;
+
+    using vector_interface<typename B::scalar,
+                           acceleration<B, E>>::vector_interface;
+
+    /// @brief Construct an acceleration vector from a frame vector
+    /// @param v Frame vector
+    constexpr acceleration(typename E::vector v)
+        : acceleration(B{}, std::move(v))
+    {}
+
+    /// @brief Construct an acceleration vector from a frame vector
+    /// @param b Observation frame
+    /// @param v Frame vector
+    constexpr acceleration(B, typename E::vector v)
+        : vector_interface<typename B::scalar, acceleration<B, E>>{
+              std::move(v.x()), std::move(v.y()), std::move(v.z())}
+    {}
+
+    /// @name Frame expression operations
+    /// @{
+
+    /// @brief Express this acceleration in another frame
+    /// @tparam E2 Target expression frame
+    /// @param ori Orientation of `E2` relative the frame associated with this
+    /// acceleration
+    /// @return This acceleration expressed in frame `E2`
+    template <kinematic::frame E2>
+    [[nodiscard]] auto express_in(const orientation<E, E2>& ori) const
+        -> acceleration<B, E2>
+    {
+        return ori.rotate(std::bit_cast<typename E::vector>(*this));
+    }
+
+    /// @brief Express this acceleration in another frame
+    /// @tparam E2 Target expression frame
+    /// @tparam World Kinematic world
+    /// @param world World instance relating the frame associated with the
+    /// current expression frame and `E2`
+    /// @return This acceleration expressed in frame `E2`
+    template <kinematic::frame E2, kinematic::world World>
+    [[nodiscard]] auto express_in(const World& world) const
+        -> acceleration<B, E2>
+    {
+        return world.template express<E, E2>().rotate(
+            std::bit_cast<typename E::vector>(*this));
+    }
+
+    /// @}
+};
+
+/// @name Deduction guides
+/// @{
+
+template <kinematic::frame B, kinematic::vector V>
+acceleration(B, V) -> acceleration<B, typename V::frame>;
+
+/// @}
+
+}  // namespace turtle
+
+namespace fmt {
+
+template <class B, class E, class Char>
+struct is_range<turtle::acceleration<B, E>, Char> : std::false_type {};
+
+template <class B, class E>
+struct formatter<turtle::acceleration<B, E>> : formatter<turtle::vector<E>> {
+    template <class FormatContext>
+    auto format(const turtle::acceleration<B, E>& a, FormatContext& ctx)
+    {
+        auto&& out = ctx.out();
+
+        format_to(out, "<a, {}>: ", B{});
+        formatter<turtle::vector<E>>::format(
+            std::bit_cast<turtle::vector<E>>(a), ctx);
+
+        return out;
+    }
+};
+
+}  // namespace fmt
@@ -0,0 +1,330 @@
+#pragma once
+
+#include "checks.hpp"
+#include "fwd.hpp"
+#include "orientation.hpp"
+#include "quaternion.hpp"
+#include "quaternion_span.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+namespace turtle {
+
+namespace detail {
+
+// Obtains the eigenvector of the largest eigenvalue of a symmetric 4 x 4
+// matrix with cyclic Jacobi rotations
+template <class T>
+auto principal_eigenvector(std::array<std::array<T, 4>, 4> a)
+    -> std::array<T, 4>
+{
+    using std::abs;
+    using std::sqrt;
+
+    constexpr auto max_sweeps = 16;
+    constexpr auto n = std::size_t{4};
+
+    auto v = std::array<std::array<T, 4>, 4>{};
+    for (auto i = std::size_t{}; i != n; ++i) {
+        v[i][i] = T{1};
+    }
+
+    for (auto sweep = 0; sweep != max_sweeps; ++sweep) {
+        auto off = T{};
+        auto diag = T{};
+        for (auto p = std::size_t{}; p != n; ++p) {
+            diag += a[p][p] * a[p][p];
+            for (auto q = p + 1; q != n; ++q) {
+                off += a[p][q] * a[p][q];
+            }
+        }
+        if (off <= std::numeric_limits<T>::epsilon() *
+                       std::numeric_limits<T>::epsilon() * diag) {
+            break;
+        }
+
+        for (auto p = std::size_t{}; p != n; ++p) {
+            for (auto q = p + 1; q != n; ++q) {
+                if (a[p][q] == T{}) {
+                    continue;
+                }
+
+                const auto theta = (a[q][q] - a[p][p]) / (T{2} * a[p][q]);
+                const auto t = (theta < T{} ? T{-1} : T{1}) /
+                               (abs(theta) + sqrt(theta * theta + T{1}));
+                const auto c = T{1} / sqrt(t * t + T{1});
+                const auto s = t * c;
+
+                for (auto k = std::size_t{}; k != n; ++k) {
+                    const auto akp = a[k][p];
+                    const auto akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (auto k = std::size_t{}; k != n; ++k) {
+                    const auto apk = a[p][k];
+                    const auto aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (auto k = std::size_t{}; k != n; ++k) {
+                    const auto vkp = v[k][p];
+                    const auto vkq = v[k][q];
+                    v[k][p] = c * vkp - s * vkq;
+                    v[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    auto largest = std::size_t{};
+    for (auto i = std::size_t{1}; i != n; ++i) {
+        if (a[i][i] > a[largest][largest]) {
+            largest = i;
+        }
+    }
+
+    return {v[0][largest], v[1][largest], v[2][largest], v[3][largest]};
+}
+
+}  // namespace detail
+
+/// @brief Streaming average of unit quaternions
+/// @tparam T Scalar type
+///
+/// Accumulates samples without storing them, so that an average can be
+/// obtained at any time. Two averages are provided:
+///
+/// * `mean` maximizes the weighted sum of `(q · qᵢ)²`, which also minimizes
+///   the weighted sum of squared Frobenius distances of the corresponding
+///   rotation matrices. It is the eigenvector of the largest eigenvalue of the
+///   accumulated outer products `Σ wᵢ qᵢ qᵢᵀ`.
+/// * `fast_mean` normalizes the weighted sum of the samples, with each sample
+///   negated if needed to lie in the hemisphere of the first sample. It
+///   approximates `mean` closely if samples are clustered, which is typical for
+///   redundant estimates, and avoids the eigendecomposition.
+///
+/// Both averages are independent of the signs of the samples.
+/// @see https://doi.org/10.2514/1.28949
+template <class T = DefaultScalar>
+class quaternion_average {
+    // upper triangle of Σ wᵢ qᵢ qᵢᵀ, in row order
+    std::array<T, 10> outer_{};
+    std::array<T, 4> sum_{};
+    std::array<T, 4> reference_{};
+    T weight_{};
+
+    static constexpr auto accumulate(std::array<T, 10>& outer,
+                                     std::array<T, 4>& sum,
+                                     const std::array<T, 4>& reference,
+                                     const std::array<T, 4>& q,
+                                     T weight) -> void
+    {
+        const auto& [w, x, y, z] = q;
+
+        outer[0] += weight * w * w;
+        outer[1] += weight * w * x;
+        outer[2] += weight * w * y;
+        outer[3] += weight * w * z;
+        outer[4] += weight * x * x;
+        outer[5] += weight * x * y;
+        outer[6] += weight * x * z;
+        outer[7] += weight * y * y;
+        outer[8] += weight * y * z;
+        outer[9] += weight * z * z;
+
+        const auto dot = reference[0] * w + reference[1] * x +
+                         reference[2] * y + reference[3] * z;
+        const auto s = dot < T{} ? -weight : weight;
+        for (auto i = std::size_t{}; i != 4; ++i) {
+            sum[i] += s * q[i];
+        }
+    }
+
+  public:
+    using scalar = T;  ///< Average scalar type
+
+    /// @brief Adds a sample
+    /// @param q Unit quaternion
+    /// @param weight Sample weight
+    constexpr auto add(const quaternion<T>& q, T weight = T{1}) -> void
+    {
+        const auto c = std::array{q.w(), q.x(), q.y(), q.z()};
+        if (weight_ == T{}) {
+            reference_ = c;
+        }
+        weight_ += weight;
+        accumulate(outer_, sum_, reference_, c, weight);
+    }
+
+    /// @brief Adds a batch of samples with unit weight
+    /// @param qs Unit quaternions
+    /// @pre All component arrays of `qs` have the same size, checked with
+    /// `checks::debug`
+    ///
+    /// The loop body has no branches and keeps the sums in local variables,
+    /// allowing the compiler to vectorize the accumulation.
+    constexpr auto add(quaternion_span<const T> qs) -> void
+    {
+        checks::expect<checks::debug>(qs.consistent());
+
+        if (qs.size() == 0) {
+            return;
+        }
+        if (weight_ == T{}) {
+            reference_ = {qs.w[0], qs.x[0], qs.y[0], qs.z[0]};
+        }
+        weight_ += static_cast<T>(qs.size());
+
+        auto outer = outer_;
+        auto sum = sum_;
+        const auto reference = reference_;
+        for (auto i = std::size_t{}; i != qs.size(); ++i) {
+            accumulate(outer,
+                       sum,
+                       reference,
+                       {qs.w[i], qs.x[i], qs.y[i], qs.z[i]},
+                       T{1});
+        }
+        outer_ = outer;
+        sum_ = sum;
+    }
+
+    /// @brief Obtains the total weight of the added samples
+    [[nodiscard]] constexpr auto weight() const noexcept -> const T&
+    {
+        return weight_;
+    }
+
+    /// @brief Calculates the average maximizing the weighted sum of squared
+    /// dot products with the samples
+    /// @pre At least one sample with positive weight has been added, checked
+    /// with `checks::debug`
+    ///
+    /// The sign of the result is chosen to lie in the hemisphere of the first
+    /// sample.
+    [[nodiscard]] auto mean() const -> quaternion<T>
+    {
+        checks::expect<checks::debug>(weight_ > T{});
+
+        auto m = std::array<std::array<T, 4>, 4>{};
+        auto k = std::size_t{};
+        for (auto i = std::size_t{}; i != 4; ++i) {
+            for (auto j = i; j != 4; ++j) {
+                m[i][j] = outer_[k];
+                m[j][i] = outer_[k];
+                ++k;
+            }
+        }
+
+        const auto v = detail::principal_eigenvector(m);
+
+        auto dot = T{};
+        for (auto i = std::size_t{}; i != 4; ++i) {
+            dot += reference_[i] * v[i];
+        }
+        const auto s = dot < T{} ? T{-1} : T{1};
+
+        return quaternion<T>{s * v[0], s * v[1], s * v[2], s * v[3]}
+            .renormalized();
+    }
+
+    /// @brief Calculates the normalized sum of the samples, aligned with the
+    /// first sample
+    /// @pre At least one sample with positive weight has been added, checked
+    /// with `checks::debug`
+    [[nodiscard]] auto fast_mean() const -> quaternion<T>
+    {
+        using std::sqrt;
+
+        checks::expect<checks::debug>(weight_ > T{});
+
+        const auto& q = sum_;
+        const auto k =
+            T{1} / sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+        return {k * q[0], k * q[1], k * q[2], k * q[3]};
+    }
+};
+
+/// @brief Averages a batch of unit quaternions
+/// @param qs Unit quaternions
+/// @pre `qs` is not empty
+/// @see quaternion_average::mean
+template <class T>
+auto mean(quaternion_span<const T> qs) -> quaternion<T>
+{
+    auto avg = quaternion_average<T>{};
+    avg.add(qs);
+    return avg.mean();
+}
+
+/// @brief Approximately averages a batch of unit quaternions
+/// @param qs Unit quaternions
+/// @pre `qs` is not empty
+/// @see quaternion_average::fast_mean
+template <class T>
+auto fast_mean(quaternion_span<const T> qs) -> quaternion<T>
+{
+    auto avg = quaternion_average<T>{};
+    avg.add(qs);
+    return avg.fast_mean();
+}
+
+namespace detail {
+
+template <kinematic::frame From, kinematic::frame To, class Mean>
+auto mean(std::span<const orientation<From, To>> oris, Mean rotation)
+    -> orientation<From, To>
+{
+    using T = typename From::scalar;
+
+    auto avg = quaternion_average<T>{};
+    auto w = velocity<From>{};
+    auto a = acceleration<From>{};
+    auto r = position<From>{};
+    for (const auto& ori : oris) {
+        avg.add(ori.rotation());
+        w += ori.angular_velocity();
+        a += ori.angular_acceleration();
+        r += ori.origin();
+    }
+
+    const auto k = T{1} / avg.weight();
+    return orientation<From, To>{rotation(avg)}
+        .with(k * w)
+        .with(k * a)
+        .with(k * r);
+}
+
+}  // namespace detail
+
+/// @brief Averages a batch of orientations
+/// @param oris Orientations
+/// @pre `oris` is not empty
+///
+/// Rotations are averaged with `quaternion_average::mean`, and angular
+/// velocities, angular accelerations and origins arithmetically.
+template <kinematic::frame From, kinematic::frame To>
+auto mean(std::span<const orientation<From, To>> oris) -> orientation<From, To>
+{
+    return detail::mean(oris, [](const auto& avg) { return avg.mean(); });
+}
+
+/// @brief Approximately averages a batch of orientations
+/// @param oris Orientations
+/// @pre `oris` is not empty
+///
+/// Rotations are averaged with `quaternion_average::fast_mean`, and angular
+/// velocities, angular accelerations and origins arithmetically.
+template <kinematic::frame From, kinematic::frame To>
+auto fast_mean(std::span<const orientation<From, To>> oris)
+    -> orientation<From, To>
+{
+    return detail::mean(oris, [](const auto& avg) { return avg.fast_mean(); });
+}
+
+}  // namespace turtle
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "util/ulp_diff.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <type_traits>
+
+namespace turtle {
+
+/// @brief Obtains the value of a scalar, without partial derivatives
+/// @param x Scalar value
+///
+/// Scalar types carrying partial derivatives, such as `dual`, provide an
+/// overload found by argument-dependent lookup.
+template <class T>
+constexpr auto primal(const T& x) noexcept -> const T&
+{
+    return x;
+}
+
+}  // namespace turtle
+
+/// @brief Precondition checking policies
+///
+/// A policy is selected per reference frame, e.g. `frame<"A", double,
+/// checks::none>`, and controls the runtime checks performed by operations on
+/// that frame's kinematic types. A failed check aborts the program.
+///
+/// A policy may additionally define a static member function
+/// `observe_normalized(const T& squared_norm)`, which is called with every
+/// checked squared norm outside of constant evaluation, whether or not the
+/// policy is enabled.
+namespace turtle::checks {
+
+/// @brief Never checks preconditions
+struct none {
+    static constexpr bool enabled = false;  ///< Whether checks are performed
+
+    /// @brief Tolerance used when checking for unit norm
+    static constexpr std::size_t max_normalized_ulp_diff{4};
+};
+
+/// @brief Checks preconditions unless `NDEBUG` is defined, like `assert`
+struct debug {
+#ifdef NDEBUG
+    static constexpr bool enabled = false;
+#else
+    static constexpr bool enabled = true;
+#endif
+
+    /// @copydoc none::max_normalized_ulp_diff
+    static constexpr std::size_t max_normalized_ulp_diff{4};
+};
+
+/// @brief Always checks preconditions, regardless of `NDEBUG`
+struct always {
+    static constexpr bool enabled = true;  ///< @copydoc none::enabled
+
+    /// @copydoc none::max_normalized_ulp_diff
+    static constexpr std::size_t max_normalized_ulp_diff{4};
+};
+
+/// @brief Aborts if a condition does not hold and `Policy` is enabled
+/// @tparam Policy Checking policy
+/// @param cond Checked condition
+template <class Policy>
+constexpr auto expect(bool cond) -> void
+{
+    if constexpr (Policy::enabled) {
+        if (not cond) {
+            std::abort();
+        }
+    }
+}
+
+/// @brief Aborts if a squared norm is not unity and `Policy` is enabled
+/// @tparam Policy Checking policy
+/// @param squared_norm Squared norm of a vector or quaternion
+///
+/// The squared norm is compared to unity with a tolerance of
+/// `Policy::max_normalized_ulp_diff`. Only the value of a `dual` squared norm
+/// is compared.
+template <class Policy, class T>
+constexpr auto normalized(const T& squared_norm) -> void
+{
+    if constexpr (requires { Policy::observe_normalized(squared_norm); }) {
+        if (not std::is_constant_evaluated()) {
+            Policy::observe_normalized(squared_norm);
+        }
+    }
+    if constexpr (Policy::enabled) {
+        const auto& value = primal(squared_norm);
+        expect<Policy>(
+            Policy::max_normalized_ulp_diff >=
+            util::ulp_diff(std::remove_cvref_t<decltype(value)>{1}, value));
+    }
+}
+
+}  // namespace turtle::checks
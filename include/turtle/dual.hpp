@@ -0,0 +1,268 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace turtle {
+
+/// @brief A dual number carrying partial derivatives with respect to `K`
+/// variables
+/// @tparam T Floating-point type
+/// @tparam K Number of partial derivatives
+///
+/// Forward-mode automatic differentiation scalar. Used as the scalar type of
+/// the frames in a world, an evaluation of a kinematic quantity yields its
+/// value and its partial derivatives with respect to `K` seeded inputs, e.g.
+/// the partial velocities of a point with respect to each generalized speed.
+/// The partial derivatives are exact to rounding, unlike finite differences.
+///
+/// Every operation also updates all `K` partial derivatives, so an evaluation
+/// with dual numbers is not expected to be faster than `K + 1` evaluations
+/// with `T`. Comparisons only consider values, so branches in generic code
+/// follow the value.
+///
+/// The non-differentiable points of `sqrt`, `hypot` and `abs` at zero are
+/// assigned zero partial derivatives.
+template <std::floating_point T, std::size_t K>
+class dual {
+  public:
+    using value_type = T;                    ///< Value type
+    using partials_type = std::array<T, K>;  ///< Partial derivatives type
+
+  private:
+    T value_{};
+    partials_type partials_{};
+
+    template <class F>
+    constexpr auto transform(F f) -> dual&
+    {
+        for (auto& d : partials_) {
+            d = f(d);
+        }
+        return *this;
+    }
+
+    // Obtains `a * x + b * y` with partials combined likewise
+    static constexpr auto
+    combine(T value, T a, const dual& x, T b, const dual& y) -> dual
+    {
+        auto r = dual{value};
+        for (auto i = std::size_t{}; i != K; ++i) {
+            r.partials_[i] = a * x.partials_[i] + b * y.partials_[i];
+        }
+        return r;
+    }
+
+    // Obtains `value` with the partials of `x` scaled by `a`
+    static constexpr auto chain(T value, T a, const dual& x) -> dual
+    {
+        auto r = dual{value, x.partials_};
+        return r.transform([a](T d) { return a * d; });
+    }
+
+  public:
+    /// @brief Constructs a zero constant
+    constexpr dual() = default;
+
+    /// @brief Constructs a constant
+    /// @param value Value
+    ///
+    /// @note Implicit to allow mixing constants with dual numbers.
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    constexpr dual(T value) : value_{value} {}
+
+    /// @brief Constructs a dual number from a value and partial derivatives
+    /// @param value Value
+    /// @param partials Partial derivatives
+    constexpr dual(T value, partials_type partials)
+        : value_{value}, partials_{std::move(partials)}
+    {}
+
+    /// @brief Constructs an independent variable
+    /// @param value Value
+    /// @param i Index of the variable
+    /// @pre `i < K`
+    ///
+    /// The partial derivative with respect to variable `i` is one and all
+    /// others are zero.
+    static constexpr auto variable(T value, std::size_t i) -> dual
+    {
+        auto x = dual{value};
+        x.partials_[i] = T{1};
+        return x;
+    }
+
+    /// @brief Obtains the value
+    [[nodiscard]] constexpr auto value() const noexcept -> const T&
+    {
+        return value_;
+    }
+
+    /// @brief Obtains the partial derivatives
+    [[nodiscard]] constexpr auto partials() const noexcept
+        -> const partials_type&
+    {
+        return partials_;
+    }
+
+    /// @brief Obtains the partial derivative with respect to variable `i`
+    /// @pre `i < K`
+    [[nodiscard]] constexpr auto partial(std::size_t i) const -> const T&
+    {
+        return partials_[i];
+    }
+
+    /// @name Arithmetic operations
+    /// @{
+
+    constexpr auto operator+=(const dual& x) -> dual&
+    {
+        value_ += x.value_;
+        for (auto i = std::size_t{}; i != K; ++i) {
+            partials_[i] += x.partials_[i];
+        }
+        return *this;
+    }
+    constexpr auto operator-=(const dual& x) -> dual&
+    {
+        value_ -= x.value_;
+        for (auto i = std::size_t{}; i != K; ++i) {
+            partials_[i] -= x.partials_[i];
+        }
+        return *this;
+    }
+    constexpr auto operator*=(const dual& x) -> dual&
+    {
+        return *this = *this * x;
+    }
+    constexpr auto operator/=(const dual& x) -> dual&
+    {
+        return *this = *this / x;
+    }
+
+    friend constexpr auto operator+(const dual& x) -> dual { return x; }
+    friend constexpr auto operator-(dual x) -> dual
+    {
+        x.value_ = -x.value_;
+        return x.transform([](T d) { return -d; });
+    }
+
+    friend constexpr auto operator+(dual x, const dual& y) -> dual
+    {
+        return x += y;
+    }
+    friend constexpr auto operator-(dual x, const dual& y) -> dual
+    {
+        return x -= y;
+    }
+    friend constexpr auto operator*(const dual& x, const dual& y) -> dual
+    {
+        return combine(x.value_ * y.value_, y.value_, x, x.value_, y);
+    }
+    friend constexpr auto operator/(const dual& x, const dual& y) -> dual
+    {
+        const auto r = x.value_ / y.value_;
+        return combine(r, T{1} / y.value_, x, -r / y.value_, y);
+    }
+
+    /// @}
+
+    /// @name Comparison operations
+    /// @{
+    friend constexpr auto operator==(const dual& x, const dual& y) -> bool
+    {
+        return x.value_ == y.value_;
+    }
+    friend constexpr auto operator<=>(const dual& x, const dual& y)
+    {
+        return x.value_ <=> y.value_;
+    }
+    /// @}
+
+    /// @name Elementary functions
+    /// Found by argument-dependent lookup, so generic code calls these with
+    /// `using std::sqrt; sqrt(x);`.
+    /// @{
+    friend auto sqrt(const dual& x) -> dual
+    {
+        const auto r = std::sqrt(x.value_);
+        return chain(r, (r == T{}) ? T{} : T{0.5} / r, x);
+    }
+    friend auto sin(const dual& x) -> dual
+    {
+        return chain(std::sin(x.value_), std::cos(x.value_), x);
+    }
+    friend auto cos(const dual& x) -> dual
+    {
+        return chain(std::cos(x.value_), -std::sin(x.value_), x);
+    }
+    friend auto exp(const dual& x) -> dual
+    {
+        const auto r = std::exp(x.value_);
+        return chain(r, r, x);
+    }
+    friend auto abs(const dual& x) -> dual
+    {
+        const auto sign = std::signbit(x.value_) ? T{-1} : T{1};
+        return chain(std::abs(x.value_), sign, x);
+    }
+    friend auto atan2(const dual& y, const dual& x) -> dual
+    {
+        const auto r2 = x.value_ * x.value_ + y.value_ * y.value_;
+        return combine(std::atan2(y.value_, x.value_),
+                       -y.value_ / r2,
+                       x,
+                       x.value_ / r2,
+                       y);
+    }
+    friend auto hypot(const dual& x, const dual& y) -> dual
+    {
+        const auto r = std::hypot(x.value_, y.value_);
+        if (r == T{}) {
+            return dual{};
+        }
+        return combine(r, x.value_ / r, x, y.value_ / r, y);
+    }
+    friend auto hypot(const dual& x, const dual& y, const dual& z) -> dual
+    {
+        const auto r = std::hypot(x.value_, y.value_, z.value_);
+        if (r == T{}) {
+            return dual{};
+        }
+        auto h = combine(r, x.value_ / r, x, y.value_ / r, y);
+        for (auto i = std::size_t{}; i != K; ++i) {
+            h.partials_[i] += z.value_ / r * z.partials_[i];
+        }
+        return h;
+    }
+    /// @}
+};
+
+/// @brief Obtains the value of a dual number, without partial derivatives
+/// @param x Dual number
+///
+/// Found by argument-dependent lookup, allowing checks on floating-point
+/// representations, such as `ulp_diff`, to accept dual numbers.
+/// @see primal(const T&)
+template <class T, std::size_t K>
+constexpr auto primal(const dual<T, K>& x) noexcept -> const T&
+{
+    return x.value();
+}
+
+}  // namespace turtle
+
+namespace std {
+
+/// @brief Limits of the value of a dual number
+///
+/// Members return the limits of `T`, which convert to constant dual numbers.
+template <class T, std::size_t K>
+class numeric_limits<turtle::dual<T, K>> : public numeric_limits<T> {};
+
+}  // namespace std
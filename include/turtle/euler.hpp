@@ -0,0 +1,233 @@
+#pragma once
+
+#include "checks.hpp"
+#include "fwd.hpp"
+#include "quaternion.hpp"
+#include "quaternion_span.hpp"
+#include "velocity.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+namespace turtle {
+
+/// @brief Axes of the three rotations of an Euler angle sequence
+///
+/// Sequences with three distinct axes are Tait-Bryan sequences, and sequences
+/// with equal first and last axes are proper Euler sequences.
+enum class euler_sequence {
+    xyz,
+    xzy,
+    yxz,
+    yzx,
+    zxy,
+    zyx,
+    xyx,
+    xzx,
+    yxy,
+    yzy,
+    zxz,
+    zyz,
+};
+
+/// @brief Frame holding the axes of an Euler angle sequence
+enum class euler_axes {
+    /// Each rotation is about an axis of the frame produced by the previous
+    /// rotations, also known as intrinsic rotations
+    body_fixed,
+    /// Each rotation is about an axis of the initial frame, also known as
+    /// extrinsic rotations
+    space_fixed,
+};
+
+namespace detail {
+
+constexpr auto euler_indices(euler_sequence seq) -> std::array<std::size_t, 3>
+{
+    switch (seq) {
+        case euler_sequence::xyz:
+            return {0, 1, 2};
+        case euler_sequence::xzy:
+            return {0, 2, 1};
+        case euler_sequence::yxz:
+            return {1, 0, 2};
+        case euler_sequence::yzx:
+            return {1, 2, 0};
+        case euler_sequence::zxy:
+            return {2, 0, 1};
+        case euler_sequence::zyx:
+            return {2, 1, 0};
+        case euler_sequence::xyx:
+            return {0, 1, 0};
+        case euler_sequence::xzx:
+            return {0, 2, 0};
+        case euler_sequence::yxy:
+            return {1, 0, 1};
+        case euler_sequence::yzy:
+            return {1, 2, 1};
+        case euler_sequence::zxz:
+            return {2, 0, 2};
+        case euler_sequence::zyz:
+            return {2, 1, 2};
+    }
+    return {};
+}
+
+}  // namespace detail
+
+/// @brief Angles of an Euler angle sequence
+/// @tparam Seq Rotation axes
+/// @tparam Axes Frame holding the rotation axes
+/// @tparam T Scalar type
+///
+/// Describes the orientation reached from an initial frame by rotating by
+/// `first`, `second` and `third` about the axes of `Seq`, in that order. For
+/// example, a yaw-lean-roll stack is
+/// `euler_angles<euler_sequence::zxy>{yaw, lean, roll}`.
+///
+/// The rotation and the angular velocity are calculated in closed form from
+/// the half angle sines and cosines, instead of composing three orientations.
+template <euler_sequence Seq,
+          euler_axes Axes = euler_axes::body_fixed,
+          class T = DefaultScalar>
+struct euler_angles {
+    using scalar = T;  ///< Angle scalar type
+
+    static constexpr auto sequence = Seq;  ///< Rotation axes
+    static constexpr auto axes = Axes;     ///< Frame holding the axes
+
+    T first{};   ///< Angle of the first rotation
+    T second{};  ///< Angle of the second rotation
+    T third{};   ///< Angle of the third rotation
+
+    /// @brief Obtains the rotation as a unit quaternion
+    ///
+    /// The result rotates the initial frame to align with the final frame, as
+    /// stored by `orientation`.
+    [[nodiscard]] auto rotation() const -> quaternion<T>
+    {
+        const auto [a, b, c] = half_sincos();
+        const auto e = T{parity};
+
+        auto q = std::array<T, 4>{};
+        if constexpr (i != k) {
+            q[0] = a.c * b.c * c.c - e * a.s * b.s * c.s;
+            q[1 + i] = a.s * b.c * c.c + e * a.c * b.s * c.s;
+            q[1 + j] = a.c * b.s * c.c - e * a.s * b.c * c.s;
+            q[1 + k] = a.c * b.c * c.s + e * a.s * b.s * c.c;
+        } else {
+            q[0] = b.c * (a.c * c.c - a.s * c.s);
+            q[1 + i] = b.c * (a.c * c.s + a.s * c.c);
+            q[1 + j] = b.s * (a.c * c.c + a.s * c.s);
+            q[1 + m] = e * b.s * (a.s * c.c - a.c * c.s);
+        }
+        return {q[0], q[1], q[2], q[3]};
+    }
+
+    /// @brief Calculates the angular velocity from Euler angle rates
+    /// @tparam F Initial frame
+    /// @param rates Rates of change of `first`, `second` and `third`
+    /// @return Angular velocity of the final frame relative `F`, expressed in
+    /// `F`
+    template <kinematic::frame F>
+    [[nodiscard]] auto angular_velocity(const euler_angles& rates) const
+        -> velocity<F>
+    {
+        const auto [a, b, c] = half_sincos();
+        const auto [da, db, dc] = body_order(rates);
+        const auto e = T{parity};
+
+        // sines and cosines of the full angles
+        const auto ca = a.c * a.c - a.s * a.s;
+        const auto sa = T{2} * a.s * a.c;
+        const auto cb = b.c * b.c - b.s * b.s;
+        const auto sb = T{2} * b.s * b.c;
+
+        auto w = std::array<T, 3>{};
+        if constexpr (i != k) {
+            w[i] = da + e * sb * dc;
+            w[j] = ca * db - e * sa * cb * dc;
+            w[m] = e * sa * db + ca * cb * dc;
+        } else {
+            w[i] = da + cb * dc;
+            w[j] = ca * db + sa * sb * dc;
+            w[m] = e * (sa * db - ca * sb * dc);
+        }
+        return typename F::vector{w[0], w[1], w[2]};
+    }
+
+  private:
+    struct sincos {
+        T s;
+        T c;
+    };
+
+    // Space-fixed rotations about axes i, j, k by angles a, b, c are equal to
+    // body-fixed rotations about axes k, j, i by angles c, b, a
+    static constexpr auto body_indices = [] {
+        const auto n = detail::euler_indices(Seq);
+        if constexpr (Axes == euler_axes::space_fixed) {
+            return std::array{n[2], n[1], n[0]};
+        } else {
+            return n;
+        }
+    }();
+
+    // body-fixed axes, with `m` the axis not in `{i, j}`
+    static constexpr auto i = body_indices[0];
+    static constexpr auto j = body_indices[1];
+    static constexpr auto k = body_indices[2];
+    static constexpr auto m = 3 - i - j;
+
+    // +1 if `i` and `j` are in cyclic order, -1 otherwise
+    static constexpr auto parity = (j + 3 - i) % 3 == 1 ? 1 : -1;
+
+    static constexpr auto body_order(const euler_angles& angles)
+        -> std::array<T, 3>
+    {
+        if constexpr (Axes == euler_axes::space_fixed) {
+            return {angles.third, angles.second, angles.first};
+        } else {
+            return {angles.first, angles.second, angles.third};
+        }
+    }
+
+    [[nodiscard]] auto half_sincos() const -> std::array<sincos, 3>
+    {
+        using std::cos;
+        using std::sin;
+
+        const auto angles = body_order(*this);
+
+        auto out = std::array<sincos, 3>{};
+        for (auto n = std::size_t{}; n != 3; ++n) {
+            const auto h = angles[n] / T{2};
+            out[n] = {sin(h), cos(h)};
+        }
+        return out;
+    }
+};
+
+/// @brief Converts a batch of Euler angles to unit quaternions
+/// @param angles Euler angles
+/// @param out Receives `angles[i].rotation()` for each `i`
+/// @pre All arguments have the same size
+///
+/// The loop body has no branches and, apart from the calls to `sin` and
+/// `cos`, may be vectorized by the compiler.
+/// @see euler_angles::rotation
+template <euler_sequence Seq, euler_axes Axes, class T>
+auto to_quaternion(std::span<const euler_angles<Seq, Axes, T>> angles,
+                   quaternion_span<T> out) -> void
+{
+    checks::expect<checks::debug>(out.consistent() and
+                                  out.size() == angles.size());
+
+    for (auto i = std::size_t{}; i != angles.size(); ++i) {
+        out.set(i, angles[i].rotation());
+    }
+}
+
+}  // namespace turtle
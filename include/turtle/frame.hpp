@@ -1,12 +1,16 @@
 #pragma once
 
+#include "acceleration.hpp"
+#include "checks.hpp"
 #include "fwd.hpp"
+#include "numerics.hpp"
 #include "position.hpp"
 #include "vector.hpp"
 #include "velocity.hpp"
 
 #include "fmt/format.h"
 
+#include <cstddef>
 #include <string_view>
 
 namespace turtle {
@@ -14,13 +18,27 @@ namespace turtle {
 /// @brief A reference frame
 /// @tparam Name Reference frame description, defined as a string literal
 /// @tparam T Scalar type
+/// @tparam Checks Precondition checking policy
+/// @tparam Numerics Numerical evaluation policy
 ///
 /// A Cartesian reference frame allowing definition of relative distance and
 /// motion. These reference frames have no origin and are related to other
 /// frames by an `orientation`.
-template <detail::descriptor Name, class T = DefaultScalar>
+///
+/// `Checks` selects the runtime checks (e.g. unit norm of rotations) performed
+/// by operations on vectors and orientations starting in this frame. See
+/// `checks::none`, `checks::debug` and `checks::always`.
+///
+/// `Numerics` selects how `norm` and `normalized` are evaluated for vectors
+/// in this frame. See `numerics::safe` and `numerics::fast`.
+template <detail::descriptor Name,
+          class T = DefaultScalar,
+          class Checks = checks::debug,
+          class Numerics = numerics::default_policy_t<T>>
 struct frame {
-    using scalar = T;  ///< Frame scalar type
+    using scalar = T;                  ///< Frame scalar type
+    using check_policy = Checks;       ///< Frame precondition checking policy
+    using numerics_policy = Numerics;  ///< Frame numerical evaluation policy
 
     /// @name Kinematic types
     /// @{
@@ -34,11 +52,74 @@ struct frame {
     /// @brief Frame velocity vector type
     using velocity = turtle::velocity<frame, frame>;
 
+    /// @brief Frame acceleration vector type
+    using acceleration = turtle::acceleration<frame, frame>;
+
+    /// @}
+
+    /// @brief Frame descriptor string literal
+    static constexpr auto name = std::string_view{Name.name.data()};
+
+    /// @name Frame basis vectors
+    /// @{
+
+    /// @brief Unit vector in the frame's x-direction
+    static constexpr vector x{T{1}, T{}, T{}};
+
+    /// @brief Unit vector in the frame's y-direction
+    static constexpr vector y{T{}, T{1}, T{}};
+
+    /// @brief Unit vector in the frame's z-direction
+    static constexpr vector z{T{}, T{}, T{1}};
+
+    /// @}
+};
+
+/// @brief A family of structurally identical reference frames
+/// @tparam Name Family description, defined as a string literal
+/// @tparam N Number of frames in the family
+/// @tparam T Scalar type
+/// @tparam Checks Precondition checking policy
+/// @tparam Numerics Numerical evaluation policy
+///
+/// Describes `N` sibling frames sharing a parent frame, such as the wheels of
+/// a vehicle. In a `world`, the family is a single leaf of the frame tree and
+/// the orientations of its members are stored contiguously in an
+/// `orientation_array`. Vectors of this type are expressed in any one member
+/// of the family.
+template <detail::descriptor Name,
+          std::size_t N,
+          class T = DefaultScalar,
+          class Checks = checks::debug,
+          class Numerics = numerics::default_policy_t<T>>
+struct frame_array {
+    using scalar = T;                  ///< Frame scalar type
+    using check_policy = Checks;       ///< Frame precondition checking policy
+    using numerics_policy = Numerics;  ///< Frame numerical evaluation policy
+
+    /// @name Kinematic types
+    /// @{
+
+    /// @brief Frame generic vector type
+    using vector = turtle::vector<frame_array>;
+
+    /// @brief Frame position vector type
+    using position = turtle::position<frame_array>;
+
+    /// @brief Frame velocity vector type
+    using velocity = turtle::velocity<frame_array, frame_array>;
+
+    /// @brief Frame acceleration vector type
+    using acceleration = turtle::acceleration<frame_array, frame_array>;
+
     /// @}
 
     /// @brief Frame descriptor string literal
     static constexpr auto name = std::string_view{Name.name.data()};
 
+    /// @brief Number of frames in the family
+    static constexpr std::size_t size = N;
+
     /// @name Frame basis vectors
     /// @{
 
@@ -56,11 +137,31 @@ struct frame {
 
 }  // namespace turtle
 
-template <turtle::detail::descriptor Name>
-struct fmt::formatter<turtle::frame<Name>> : fmt::formatter<std::string_view> {
+template <turtle::detail::descriptor Name,
+          class T,
+          class Checks,
+          class Numerics>
+struct fmt::formatter<turtle::frame<Name, T, Checks, Numerics>>
+    : fmt::formatter<std::string_view> {
     template <class FormatContext>
-    auto format(const turtle::frame<Name>&, FormatContext& ctx)
+    auto
+    format(const turtle::frame<Name, T, Checks, Numerics>&, FormatContext& ctx)
     {
         return fmt::formatter<std::string_view>::format(Name.name.data(), ctx);
     }
 };
+
+template <turtle::detail::descriptor Name,
+          std::size_t N,
+          class T,
+          class Checks,
+          class Numerics>
+struct fmt::formatter<turtle::frame_array<Name, N, T, Checks, Numerics>>
+    : fmt::formatter<std::string_view> {
+    template <class FormatContext>
+    auto format(const turtle::frame_array<Name, N, T, Checks, Numerics>&,
+                FormatContext& ctx)
+    {
+        return fmt::format_to(ctx.out(), "{}[{}]", Name.name.data(), N);
+    }
+};
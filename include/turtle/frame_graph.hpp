@@ -0,0 +1,301 @@
+#pragma once
+
+#include "checks.hpp"
+#include "frame.hpp"
+#include "fwd.hpp"
+#include "meta.hpp"
+#include "orientation.hpp"
+#include "orientation_array.hpp"
+#include "world.hpp"
+
+#include "fmt/format.h"
+#include "metal.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace turtle {
+
+/// @brief A frame topology defined at runtime
+/// @tparam T Scalar type
+/// @tparam Checks Precondition checking policy
+///
+/// Runtime counterpart of `world` for topologies that are not known at compile
+/// time, e.g. when loaded from a configuration file. Frames are identified by
+/// index and stored in topological order in flat arrays: every frame is added
+/// after its parent, and frame 0 is the root.
+///
+/// All frames share the frame type `node`, so orientations are composed with
+/// the same `orientation` and `quaternion` operations used by `world`.
+template <class T = DefaultScalar, class Checks = checks::debug>
+class frame_graph {
+  public:
+    using scalar = T;  ///< Frame graph scalar type
+
+    /// @name Kinematic types
+    /// @{
+
+    /// @brief Frame type shared by all frames in the graph
+    using node = frame<"frame_graph", T, Checks>;
+
+    // Completes `node` before it is used as both frames of an orientation
+    static_assert(std::is_same_v<typename node::scalar, T>);
+
+    /// @brief Orientation of a frame relative another frame in the graph
+    using orientation_type = orientation<node, node>;
+
+    /// @}
+
+    /// @brief Parent index of the root frame
+    static constexpr auto npos = std::numeric_limits<std::size_t>::max();
+
+  private:
+    std::vector<std::size_t> parents_{npos};
+    std::vector<std::size_t> depths_{0};
+    std::vector<std::string> names_;
+    std::vector<orientation_type> orientations_{orientation_type{}};
+
+    template <class From, class To>
+    static auto to_node(const orientation<From, To>& ori) -> orientation_type
+    {
+        const auto& v = ori.angular_velocity();
+        const auto& r = ori.origin();
+
+        return orientation_type{ori.rotation()}
+            .with(typename node::velocity{v.x(), v.y(), v.z()})
+            .with(typename node::position{r.x(), r.y(), r.z()});
+    }
+
+    template <class W, class Index, class Root, class... Fs>
+    auto add_world_frames(const W& w, Index& index, metal::list<Root, Fs...>)
+        -> void
+    {
+        (add_world_frame<Fs>(w, index), ...);
+    }
+
+    template <class F, class W, class Index>
+    auto add_world_frame(const W& w, Index& index) -> void
+    {
+        using frames = meta::flatten<typename W::tree>;
+        using path = typename W::tree::template path_to_t<F>;
+        using P = metal::at<path, metal::number<metal::size<path>::value - 2>>;
+
+        const auto parent = index[metal::find<frames, P>::value];
+
+        if constexpr (is_frame_array_v<F>) {
+            const auto& members = w.template get<P, F>();
+            for (auto i = std::size_t{}; i != F::size; ++i) {
+                add_frame(fmt::format("{}[{}]", F::name, i),
+                          parent,
+                          to_node(members[i]));
+            }
+        } else {
+            index[metal::find<frames, F>::value] = add_frame(
+                std::string{F::name}, parent, to_node(w.template get<P, F>()));
+        }
+    }
+
+  public:
+    /// @brief Constructs a frame graph containing only a root frame
+    /// @param root_name Name of the root frame
+    explicit frame_graph(std::string root_name = "root")
+        : names_{std::move(root_name)}
+    {}
+
+    /// @brief Constructs a frame graph with the topology and orientations of a
+    /// world
+    /// @param w World value
+    ///
+    /// Frames are added in depth-first order of the world frame tree. Each
+    /// member `i` of a frame family `Name` is added as a frame named
+    /// `Name[i]`.
+    template <kinematic::world W>
+    requires std::same_as<typename W::scalar, T>
+    explicit frame_graph(const W& w)
+        : frame_graph{std::string{W::root::name}}
+    {
+        using frames = meta::flatten<typename W::tree>;
+
+        auto index = std::array<std::size_t, metal::size<frames>::value>{};
+        add_world_frames(w, index, frames{});
+    }
+
+    /// @brief Adds a frame
+    /// @param name Frame name
+    /// @param parent Index of the parent frame
+    /// @param ori Orientation of the new frame relative its parent
+    /// @return Index of the new frame
+    /// @pre `parent < size()`
+    auto add_frame(std::string name,
+                   std::size_t parent,
+                   orientation_type ori = {}) -> std::size_t
+    {
+        checks::expect<Checks>(parent < size());
+
+        parents_.push_back(parent);
+        depths_.push_back(depths_[parent] + 1);
+        names_.push_back(std::move(name));
+        orientations_.push_back(std::move(ori));
+
+        return size() - 1;
+    }
+
+    /// @brief Obtains the number of frames, including the root
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return parents_.size();
+    }
+
+    /// @brief Obtains the index of the parent of a frame
+    /// @param i Frame index
+    /// @return Parent index, or `npos` for the root frame
+    [[nodiscard]] auto parent(std::size_t i) const -> std::size_t
+    {
+        return parents_[i];
+    }
+
+    /// @brief Obtains the number of edges between a frame and the root
+    /// @param i Frame index
+    [[nodiscard]] auto depth(std::size_t i) const -> std::size_t
+    {
+        return depths_[i];
+    }
+
+    /// @brief Obtains the name of a frame
+    /// @param i Frame index
+    [[nodiscard]] auto name(std::size_t i) const -> std::string_view
+    {
+        return names_[i];
+    }
+
+    /// @brief Finds a frame by name
+    /// @param name Frame name
+    /// @return Index of the first frame named `name`, if any
+    [[nodiscard]] auto find(std::string_view name) const
+        -> std::optional<std::size_t>
+    {
+        for (auto i = std::size_t{}; i != size(); ++i) {
+            if (names_[i] == name) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Accesses the orientation of a frame relative its parent
+    /// @param i Frame index
+    /// @pre `0 < i < size()`
+    /// @see world::get
+    /// @{
+    auto get(std::size_t i) -> orientation_type&
+    {
+        checks::expect<Checks>(i != 0 and i < size());
+        return orientations_[i];
+    }
+    [[nodiscard]] auto get(std::size_t i) const -> const orientation_type&
+    {
+        checks::expect<Checks>(i != 0 and i < size());
+        return orientations_[i];
+    }
+    /// @}
+
+    /// @brief Advances all orientations in time at constant angular velocity
+    /// @param dt Time step
+    /// @see world::integrate
+    auto integrate(scalar dt) -> frame_graph&
+    {
+        for (auto& ori : std::span{orientations_}.subspan(1)) {
+            ori.integrate(dt);
+        }
+        return *this;
+    }
+
+    /// @brief Expresses the orientation from the root to a frame
+    /// @param j Destination frame index
+    ///
+    /// Composes rotations along the path from the root to frame `j`, visiting
+    /// `depth(j)` frames.
+    /// @see world::express
+    [[nodiscard]] auto express(std::size_t j) const -> orientation_type
+    {
+        checks::expect<Checks>(j < size());
+
+        auto ori = orientation_type{};
+        for (; j != 0; j = parents_[j]) {
+            ori = orientations_[j] * ori;
+        }
+        return ori;
+    }
+
+    /// @brief Expresses the orientation of one frame relative another
+    /// @param i Source frame index
+    /// @param j Destination frame index
+    ///
+    /// Composes rotations along the path from frame `i` to their nearest
+    /// common ancestor to frame `j`, visiting at most `depth(i) + depth(j)`
+    /// frames.
+    /// @see world::express
+    [[nodiscard]] auto express(std::size_t i, std::size_t j) const
+        -> orientation_type
+    {
+        checks::expect<Checks>(i < size() and j < size());
+
+        // orientations of frames `i` and `j` relative to their current ancestor
+        auto to_i = orientation_type{};
+        auto to_j = orientation_type{};
+
+        while (depths_[i] > depths_[j]) {
+            to_i = orientations_[i] * to_i;
+            i = parents_[i];
+        }
+        while (depths_[j] > depths_[i]) {
+            to_j = orientations_[j] * to_j;
+            j = parents_[j];
+        }
+        while (i != j) {
+            to_i = orientations_[i] * to_i;
+            i = parents_[i];
+            to_j = orientations_[j] * to_j;
+            j = parents_[j];
+        }
+
+        return to_i.inverse() * to_j;
+    }
+
+    /// @brief Expresses the orientation from the root to every frame
+    /// @param out Receives the orientation of frame `i` relative to the root
+    /// in `out[i]`
+    /// @pre `out.size() == size()`
+    ///
+    /// Evaluates all frames with one composition per frame, reusing the result
+    /// of the parent frame.
+    auto express_all(std::span<orientation_type> out) const -> void
+    {
+        checks::expect<Checks>(out.size() == size());
+
+        out[0] = orientation_type{};
+        for (auto i = std::size_t{1}; i != size(); ++i) {
+            out[i] = out[parents_[i]] * orientations_[i];
+        }
+    }
+};
+
+/// @name Deduction guides
+/// @{
+
+template <kinematic::world W>
+frame_graph(const W&)
+    -> frame_graph<typename W::scalar, typename W::root::check_policy>;
+
+/// @}
+
+}  // namespace turtle
@@ -33,9 +33,16 @@ struct descriptor {
 
 }  // namespace detail
 
-template <detail::descriptor Name, class T>
+template <detail::descriptor Name, class T, class Checks, class Numerics>
 struct frame;
 
+template <detail::descriptor Name,
+          std::size_t N,
+          class T,
+          class Checks,
+          class Numerics>
+struct frame_array;
+
 namespace detail {
 
 /// @brief Checks whether T is a frame type
@@ -43,8 +50,29 @@ template <class T, class = void>
 struct is_frame : std::false_type {};
 
 /// @brief Specialization if T is a specialization of frame
-template <detail::descriptor Name, class T>
-struct is_frame<frame<Name, T>> : std::true_type {};
+template <detail::descriptor Name, class T, class Checks, class Numerics>
+struct is_frame<frame<Name, T, Checks, Numerics>> : std::true_type {};
+
+/// @brief Specialization if T is a specialization of frame_array
+template <detail::descriptor Name,
+          std::size_t N,
+          class T,
+          class Checks,
+          class Numerics>
+struct is_frame<frame_array<Name, N, T, Checks, Numerics>> : std::true_type {};
+
+/// @brief Checks whether T is a frame array type
+template <class T>
+struct is_frame_array : std::false_type {};
+
+/// @brief Specialization if T is a specialization of frame_array
+template <detail::descriptor Name,
+          std::size_t N,
+          class T,
+          class Checks,
+          class Numerics>
+struct is_frame_array<frame_array<Name, N, T, Checks, Numerics>>
+    : std::true_type {};
 
 }  // namespace detail
 
@@ -55,6 +83,10 @@ struct is_frame<frame<Name, T>> : std::true_type {};
 template <class T>
 using is_frame = detail::is_frame<T>;
 
+/// @brief Checks whether T is a family of identical reference frames
+template <class T>
+using is_frame_array = detail::is_frame_array<T>;
+
 /// @}
 
 /// @name Helper variable templates
@@ -63,6 +95,9 @@ using is_frame = detail::is_frame<T>;
 template <class T>
 inline constexpr bool is_frame_v = is_frame<T>::value;
 
+template <class T>
+inline constexpr bool is_frame_array_v = is_frame_array<T>::value;
+
 /// @}
 
 namespace kinematic {
@@ -71,6 +106,10 @@ namespace kinematic {
 template <class T>
 concept frame = is_frame_v<T>;
 
+/// @brief Specifies that a type is a family of identical reference frames
+template <class T>
+concept frame_array = frame<T> and is_frame_array_v<T>;
+
 }  // namespace kinematic
 
 template <class T, class D>
@@ -167,7 +206,41 @@ concept orientation = is_orientation_v<T>;
 
 }  // namespace kinematic
 
-template <class FrameTree, kinematic::orientation... Os>
+template <kinematic::frame From, kinematic::frame_array To>
+requires std::same_as<typename From::scalar, typename To::scalar>
+class orientation_array;
+
+/// @name Type traits
+/// @{
+
+/// @brief Checks whether T is an orientation array
+template <class T>
+using is_orientation_array =
+    meta::is_specialization_of<T, orientation_array>;
+
+/// @}
+
+/// @name Helper variable templates
+/// @{
+
+template <class T>
+inline constexpr bool is_orientation_array_v = is_orientation_array<T>::value;
+
+/// @}
+
+namespace kinematic {
+
+/// @brief Specifies that a type is an orientation array
+template <class T>
+concept orientation_array = is_orientation_array_v<T>;
+
+/// @brief Specifies that a type relates a frame to its parent in a world
+template <class T>
+concept edge = orientation<T> or orientation_array<T>;
+
+}  // namespace kinematic
+
+template <class FrameTree, kinematic::edge... Os>
 requires std::conjunction_v<
     meta::is_specialization_of<FrameTree, meta::tree>,
     std::is_same<typename FrameTree::root,
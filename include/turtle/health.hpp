@@ -0,0 +1,278 @@
+#pragma once
+
+#include "checks.hpp"
+#include "quaternion.hpp"
+#include "util/ulp_diff.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace turtle {
+
+/// @brief Distribution of the unit norm error of sampled quaternions
+///
+/// Errors are measured as the ULP difference between a squared norm and unity.
+struct norm_stats {
+    /// @brief Number of distribution bins
+    ///
+    /// Bin 0 counts exact unit norms and bin `k > 0` counts ULP differences in
+    /// `[2^(k-1), 2^k)`.
+    static constexpr std::size_t bins =
+        std::numeric_limits<std::size_t>::digits + 1;
+
+    /// @brief Returns the bin containing a ULP difference
+    static constexpr auto bin(std::size_t ulp_diff) noexcept -> std::size_t
+    {
+        constexpr auto digits = std::numeric_limits<std::size_t>::digits;
+        return static_cast<std::size_t>(digits - std::countl_zero(ulp_diff));
+    }
+
+    std::uint64_t samples{};          ///< Number of recorded squared norms
+    std::uint64_t near_violations{};  ///< Samples close to the tolerance
+    std::uint64_t violations{};       ///< Samples exceeding the tolerance
+    std::size_t max_ulp_diff{};       ///< Largest recorded ULP difference
+
+    std::array<std::uint64_t, bins> distribution{};  ///< Binned ULP differences
+};
+
+/// @brief Sampling monitor of quaternion norm drift
+/// @tparam T Scalar type
+///
+/// Records the norm error of quaternions, e.g. the results of long chains of
+/// orientation compositions, without aborting the program. Recording is
+/// thread-safe and the collected statistics may be read at any time.
+///
+/// A sample is a *violation* if its ULP difference exceeds the tolerance and a
+/// *near violation* if it exceeds the near tolerance but not the tolerance.
+template <class T = DefaultScalar>
+class norm_monitor {
+    static constexpr std::size_t batch_size = 64;
+    static constexpr std::size_t countdowns = 8;
+
+    // Identifies a monitor and its sample period. Epochs are unique across
+    // monitors and 0 marks an unused countdown.
+    static auto next_epoch() noexcept -> std::uint64_t
+    {
+        static auto epochs = std::atomic<std::uint64_t>{1};
+        return epochs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Calls to `sample()` left on this thread until the next recorded sample,
+    // kept for the most recently sampled monitors
+    static auto countdown(std::uint64_t epoch) noexcept -> std::size_t&
+    {
+        struct entry {
+            std::uint64_t epoch;
+            std::size_t calls;
+        };
+
+        thread_local auto entries = std::array<entry, countdowns>{};
+        thread_local auto next = std::size_t{};
+
+        for (auto& e : entries) {
+            if (e.epoch == epoch) {
+                return e.calls;
+            }
+        }
+
+        auto& e = entries[next];
+        next = (next + 1) % countdowns;
+        e = {epoch, 0};
+        return e.calls;
+    }
+
+    std::size_t tolerance_;
+    std::size_t near_tolerance_;
+    std::atomic<std::size_t> sample_period_{1};
+    std::atomic<std::uint64_t> epoch_{next_epoch()};
+
+    std::atomic<std::uint64_t> samples_{};
+    std::atomic<std::uint64_t> near_violations_{};
+    std::atomic<std::uint64_t> violations_{};
+    std::atomic<std::size_t> max_ulp_diff_{};
+    std::array<std::atomic<std::uint64_t>, norm_stats::bins> distribution_{};
+
+    auto record_ulp_diffs(std::span<const std::size_t> ulps) -> void
+    {
+        auto stats = norm_stats{};
+        for (auto ulp : ulps) {
+            stats.near_violations +=
+                static_cast<std::uint64_t>(ulp > near_tolerance_) &
+                static_cast<std::uint64_t>(ulp <= tolerance_);
+            stats.violations += static_cast<std::uint64_t>(ulp > tolerance_);
+            stats.max_ulp_diff = std::max(stats.max_ulp_diff, ulp);
+            ++stats.distribution[norm_stats::bin(ulp)];
+        }
+
+        samples_.fetch_add(ulps.size(), std::memory_order_relaxed);
+        near_violations_.fetch_add(
+            stats.near_violations, std::memory_order_relaxed);
+        violations_.fetch_add(stats.violations, std::memory_order_relaxed);
+
+        auto prev = max_ulp_diff_.load(std::memory_order_relaxed);
+        while (prev < stats.max_ulp_diff and
+               not max_ulp_diff_.compare_exchange_weak(
+                   prev, stats.max_ulp_diff, std::memory_order_relaxed)) {
+        }
+
+        for (auto i = std::size_t{}; i != norm_stats::bins; ++i) {
+            if (stats.distribution[i] != 0) {
+                distribution_[i].fetch_add(
+                    stats.distribution[i], std::memory_order_relaxed);
+            }
+        }
+    }
+
+  public:
+    /// @brief Constructs a monitor
+    /// @param tolerance ULP difference above which a sample is a violation
+    /// @param near_tolerance ULP difference above which a sample is a near
+    /// violation
+    explicit norm_monitor(std::size_t tolerance = 4,
+                          std::size_t near_tolerance = 2) noexcept
+        : tolerance_{tolerance}, near_tolerance_{near_tolerance}
+    {}
+
+    norm_monitor(const norm_monitor&) = delete;
+    norm_monitor(norm_monitor&&) = delete;
+    auto operator=(const norm_monitor&) -> norm_monitor& = delete;
+    auto operator=(norm_monitor&&) -> norm_monitor& = delete;
+    ~norm_monitor() = default;
+
+    /// @brief Obtains the monitor used by `checks::monitor`
+    static auto global() -> norm_monitor&
+    {
+        static auto instance = norm_monitor{};
+        return instance;
+    }
+
+    /// @brief Records the squared norms of a batch of quaternions
+    auto record(std::span<const quaternion<T>> qs) -> void
+    {
+        auto norms = std::array<T, batch_size>{};
+
+        while (not qs.empty()) {
+            const auto n = std::min(qs.size(), batch_size);
+
+            std::transform(
+                qs.begin(),
+                qs.begin() + static_cast<std::ptrdiff_t>(n),
+                norms.begin(),
+                [](const auto& q) { return q.squared_norm(); });
+            record_squared_norms(std::span{norms.data(), n});
+
+            qs = qs.subspan(n);
+        }
+    }
+
+    /// @brief Records a batch of squared norms
+    auto record_squared_norms(std::span<const T> squared_norms) -> void
+    {
+        auto ulps = std::array<std::size_t, batch_size>{};
+
+        while (not squared_norms.empty()) {
+            const auto n = std::min(squared_norms.size(), batch_size);
+
+            util::ulp_diff(squared_norms.first(n), T{1}, std::span{ulps});
+            record_ulp_diffs(std::span{ulps.data(), n});
+
+            squared_norms = squared_norms.subspan(n);
+        }
+    }
+
+    /// @brief Records a squared norm if it is selected by the sample period
+    ///
+    /// Every `sample_period()`-th call on this monitor from each thread is
+    /// recorded, starting with the first. Calls are counted per thread, so
+    /// unrecorded calls do not write shared state. A thread counts calls for
+    /// up to 8 monitors at once and restarts the count for others.
+    auto sample(const T& squared_norm) -> void
+    {
+        auto& calls = countdown(epoch_.load(std::memory_order_acquire));
+
+        if (calls == 0) {
+            calls = sample_period_.load(std::memory_order_relaxed) - 1;
+            record_squared_norms(std::span{&squared_norm, 1});
+        } else {
+            --calls;
+        }
+    }
+
+    /// @brief Sets the number of calls to `sample()` per recorded sample
+    /// @note A period of 0 is treated as 1
+    ///
+    /// Restarts the count of calls on every thread.
+    auto sample_period(std::size_t n) noexcept -> void
+    {
+        sample_period_.store(std::max(n, std::size_t{1}),
+                             std::memory_order_relaxed);
+        epoch_.store(next_epoch(), std::memory_order_release);
+    }
+
+    /// @brief Obtains the number of calls to `sample()` per recorded sample
+    [[nodiscard]] auto sample_period() const noexcept -> std::size_t
+    {
+        return sample_period_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Obtains the recorded statistics
+    [[nodiscard]] auto stats() const -> norm_stats
+    {
+        auto s = norm_stats{};
+        s.samples = samples_.load(std::memory_order_relaxed);
+        s.near_violations = near_violations_.load(std::memory_order_relaxed);
+        s.violations = violations_.load(std::memory_order_relaxed);
+        s.max_ulp_diff = max_ulp_diff_.load(std::memory_order_relaxed);
+        for (auto i = std::size_t{}; i != norm_stats::bins; ++i) {
+            s.distribution[i] =
+                distribution_[i].load(std::memory_order_relaxed);
+        }
+        return s;
+    }
+
+    /// @brief Clears the recorded statistics
+    auto reset() noexcept -> void
+    {
+        samples_.store(0, std::memory_order_relaxed);
+        near_violations_.store(0, std::memory_order_relaxed);
+        violations_.store(0, std::memory_order_relaxed);
+        max_ulp_diff_.store(0, std::memory_order_relaxed);
+        for (auto& d : distribution_) {
+            d.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+namespace checks {
+
+/// @brief Records unit norm errors in `norm_monitor<T>::global()` instead of
+/// aborting
+///
+/// Other preconditions are not checked.
+struct monitor {
+    static constexpr bool enabled = false;  ///< @copydoc none::enabled
+
+    /// @copydoc none::max_normalized_ulp_diff
+    static constexpr std::size_t max_normalized_ulp_diff{4};
+
+    /// @brief Samples a squared norm
+    /// @note Only the value of a `dual` squared norm is sampled.
+    template <class T>
+    static auto observe_normalized(const T& squared_norm) -> void
+    {
+        const auto& value = primal(squared_norm);
+        norm_monitor<std::remove_cvref_t<decltype(value)>>::global().sample(
+            value);
+    }
+};
+
+}  // namespace checks
+
+}  // namespace turtle
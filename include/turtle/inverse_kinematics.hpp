@@ -0,0 +1,176 @@
+#pragma once
+
+#include "fwd.hpp"
+#include "jacobian.hpp"
+#include "position.hpp"
+#include "vector_ops.hpp"
+#include "world.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+
+namespace turtle {
+
+/// @brief Options of `solve_position`
+/// @tparam T Scalar type
+template <class T = DefaultScalar>
+struct ik_options {
+    /// @brief Maximum number of iterations
+    std::size_t max_iterations{100};
+
+    /// @brief Position error norm below which the solver stops
+    T tolerance{1e-10};
+
+    /// @brief Initial damping
+    ///
+    /// A damping of 0 takes undamped Gauss-Newton steps, which are accepted
+    /// even if they increase the error.
+    T damping{1e-3};
+};
+
+/// @brief Outcome of `solve_position`
+/// @tparam T Scalar type
+template <class T = DefaultScalar>
+struct ik_result {
+    /// @brief Whether the position error is below the tolerance
+    bool converged{};
+
+    /// @brief Number of Jacobian evaluations
+    std::size_t iterations{};
+
+    /// @brief Final position error norm
+    T error{};
+};
+
+namespace detail {
+
+// Solves `m x = b` for a symmetric 3 x 3 matrix `m` with the adjugate of `m`.
+// Returns `false` if `m` is singular to working precision, i.e. if the
+// determinant is within rounding error of zero relative to the product of the
+// row norms of `m`, which bounds its magnitude by Hadamard's inequality.
+template <class T, class V>
+auto solve_symmetric(const std::array<std::array<T, 3>, 3>& m,
+                     const V& b,
+                     std::array<T, 3>& x) -> bool
+{
+    const auto c00 = m[1][1] * m[2][2] - m[1][2] * m[1][2];
+    const auto c01 = m[0][2] * m[1][2] - m[0][1] * m[2][2];
+    const auto c02 = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+    const auto c11 = m[0][0] * m[2][2] - m[0][2] * m[0][2];
+    const auto c12 = m[0][1] * m[0][2] - m[0][0] * m[1][2];
+    const auto c22 = m[0][0] * m[1][1] - m[0][1] * m[0][1];
+
+    const auto det = m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02;
+
+    auto bound = T{1};
+    for (const auto& row : m) {
+        bound *= row[0] * row[0] + row[1] * row[1] + row[2] * row[2];
+    }
+    constexpr auto eps = std::numeric_limits<T>::epsilon();
+    if (det * det <= eps * eps * bound) {
+        return false;
+    }
+
+    x = {(c00 * b.x() + c01 * b.y() + c02 * b.z()) / det,
+         (c01 * b.x() + c11 * b.y() + c12 * b.z()) / det,
+         (c02 * b.x() + c12 * b.y() + c22 * b.z()) / det};
+    return true;
+}
+
+}  // namespace detail
+
+/// @brief Moves a point to a target position by adjusting joint angles
+/// @tparam A Observation and expression frame
+/// @param w World instance, modified in place
+/// @param p Point fixed in a frame of `w`
+/// @param target Target position of `p`, relative to the origin of `A`
+/// @param options Solver options
+/// @param joints Revolute joints, each relating a frame of `w` to its parent
+///
+/// Minimizes the position error with Levenberg-Marquardt steps. Every
+/// iteration evaluates the Jacobian `J` with `jacobian` and takes the damped
+/// least squares step
+///
+/// Δθ = Jᵀ (J Jᵀ + λ I)⁻¹ e
+///
+/// for the position error `e`, solving a 3 x 3 system regardless of the number
+/// of joints. The damping `λ` is reduced tenfold after a step that reduces the
+/// error. Otherwise, the step is rejected and `λ` is increased tenfold, but
+/// not below `options.damping`. With zero `options.damping`, every step is a
+/// Gauss-Newton step and is accepted. The solver stops early if `J Jᵀ + λ I`
+/// is singular to working precision, e.g. if the joints cannot move `p` in
+/// every direction and the damping is zero.
+template <kinematic::frame A, kinematic::world W, class... Joints>
+auto solve_position(W& w,
+                    const typename W::point& p,
+                    const position<A>& target,
+                    const ik_options<typename W::scalar>& options,
+                    const Joints&... joints) -> ik_result<typename W::scalar>
+{
+    using T = typename W::scalar;
+
+    const auto position_error = [&p, &target](const W& v) {
+        return std::bit_cast<typename A::vector>(
+            target - p.template position<A>(v));
+    };
+
+    auto error = position_error(w);
+    auto result = ik_result<T>{false, 0, norm(error)};
+    auto lambda = options.damping;
+
+    while (result.error > options.tolerance and
+           result.iterations != options.max_iterations) {
+        ++result.iterations;
+
+        const auto jac = jacobian<A>(w, p, joints...);
+
+        auto m = std::array<std::array<T, 3>, 3>{};
+        for (const auto& col : jac.position) {
+            const auto v = std::array{col.x(), col.y(), col.z()};
+            for (auto r = std::size_t{}; r != 3; ++r) {
+                for (auto c = std::size_t{}; c != 3; ++c) {
+                    m[r][c] += v[r] * v[c];
+                }
+            }
+        }
+        for (auto r = std::size_t{}; r != 3; ++r) {
+            m[r][r] += lambda;
+        }
+
+        auto y = std::array<T, 3>{};
+        if (not detail::solve_symmetric(m, error, y)) {
+            break;
+        }
+
+        auto candidate = w;
+        auto i = std::size_t{};
+        const auto advance = [&]<class P, class C>(
+                                 const revolute<P, C>& joint) {
+            const auto& col = jac.position[i++];
+            auto& ori = candidate.template get<P, C>();
+            ori = joint.advanced(
+                ori, col.x() * y[0] + col.y() * y[1] + col.z() * y[2]);
+        };
+        (advance(joints), ...);
+
+        const auto candidate_error = position_error(candidate);
+        const auto candidate_norm = norm(candidate_error);
+
+        if (candidate_norm < result.error or options.damping == T{}) {
+            w = candidate;
+            error = candidate_error;
+            result.error = candidate_norm;
+            lambda /= T{10};
+        } else {
+            lambda = std::max(T{10} * lambda, options.damping);
+        }
+    }
+
+    result.converged = result.error <= options.tolerance;
+    return result;
+}
+
+}  // namespace turtle
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "fwd.hpp"
+#include "orientation.hpp"
+#include "point.hpp"
+#include "position.hpp"
+#include "quaternion.hpp"
+#include "vector_ops.hpp"
+#include "world.hpp"
+
+#include "metal.hpp"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace turtle {
+
+/// @brief A revolute joint relating two frames of a world
+/// @tparam From Parent frame
+/// @tparam To Child frame
+///
+/// Describes an edge whose orientation rotates frame `To` relative frame
+/// `From` about a fixed axis through the origin of `To`. The joint angle is
+/// the rotation angle about that axis.
+///
+/// @note `orientation` does not store a rotation axis, and the axis of an
+/// orientation at zero angle is undefined. A joint supplies it.
+template <kinematic::frame From, kinematic::frame To>
+struct revolute {
+    using scalar = typename From::scalar;  ///< Joint scalar type
+
+    /// @name Kinematic types
+    /// @{
+
+    /// @brief Parent frame
+    using source_frame = From;
+
+    /// @brief Child frame
+    using dest_frame = To;
+
+    /// @}
+
+    /// @brief Unit rotation axis, expressed in `From`
+    typename From::vector axis;
+
+    /// @brief Obtains the joint angle of an orientation
+    /// @param ori Orientation of `To` relative `From`, a rotation about `axis`
+    [[nodiscard]] auto angle(const orientation<From, To>& ori) const -> scalar
+    {
+        using std::atan2;
+
+        const auto& q = ori.rotation();
+        const auto s = q.x() * axis.x() + q.y() * axis.y() + q.z() * axis.z();
+        return scalar{2} * atan2(s, q.w());
+    }
+
+    /// @brief Obtains an orientation with the joint angle advanced
+    /// @param ori Orientation of `To` relative `From`
+    /// @param dtheta Joint angle increment
+    ///
+    /// Angular velocity, angular acceleration and origin are unchanged.
+    [[nodiscard]] auto advanced(const orientation<From, To>& ori,
+                                scalar dtheta) const -> orientation<From, To>
+    {
+        const auto dq = quaternion<scalar>{dtheta, axis};
+
+        return orientation<From, To>{(dq * ori.rotation()).renormalized()}
+            .with(ori.angular_velocity())
+            .with(ori.angular_acceleration())
+            .with(ori.origin());
+    }
+};
+
+/// @brief Jacobian of a point with respect to joint angles
+/// @tparam A Observation and expression frame
+/// @tparam N Number of joints
+///
+/// Column `i` corresponds to joint `i`.
+template <kinematic::frame A, std::size_t N>
+struct point_jacobian {
+    /// @brief Partial derivatives of the point position relative to the origin
+    /// of `A`
+    std::array<typename A::vector, N> position{};
+
+    /// @brief Partial angular velocities of the frame the point is fixed in,
+    /// relative `A`
+    std::array<typename A::vector, N> orientation{};
+};
+
+namespace detail {
+
+template <class T, class R>
+struct frame_pose {
+    quaternion<T> rotation{T{1}, T{}, T{}, T{}};
+    position<R> origin{};
+};
+
+template <class W, class F>
+using path_t = typename W::tree::template path_to_t<F>;
+
+// Checks if frame `C` is on the path from the root of `W` to frame `F`
+template <class W, class F, class C>
+inline constexpr bool on_path_v = metal::contains<path_t<W, F>, C>::value;
+
+template <class W, class C>
+using parent_of_t =
+    metal::at<path_t<W, C>,
+              metal::number<metal::size<path_t<W, C>>::value - 2>>;
+
+}  // namespace detail
+
+/// @brief Calculates the Jacobian of a point with respect to joint angles
+/// @tparam A Observation and expression frame
+/// @param w World instance
+/// @param p Point fixed in a frame of `w`
+/// @param joints Revolute joints, each relating a frame of `w` to its parent
+///
+/// The orientation of every frame relative to the world root is calculated in a
+/// single sweep of the frame tree with `world::for_each_from_root`. A joint
+/// with axis `a` and child frame origin `o` then contributes the column
+///
+/// ∂r/∂θ = ±a × (r - o)
+///
+/// which is positive if the joint is on the path from the root to the frame
+/// of `p`, negative if it is on the path from the root to `A`, and zero
+/// otherwise. Orientation columns are `±a`.
+template <kinematic::frame A, kinematic::world W, class... Joints>
+requires(W::tree::template contains_v<A> and not kinematic::frame_array<A>)
+[[nodiscard]] auto jacobian(const W& w,
+                            const typename W::point& p,
+                            const Joints&... joints)
+    -> point_jacobian<A, sizeof...(Joints)>
+{
+    using T = typename W::scalar;
+    using root = typename W::root;
+    using V = typename root::vector;
+
+    static_assert(
+        (std::is_same_v<Joints,
+                        revolute<typename Joints::source_frame,
+                                 typename Joints::dest_frame>> and
+         ...),
+        "joints must be revolute");
+
+    auto poses = std::array<detail::frame_pose<T, root>, W::frame_count>{};
+    w.for_each_from_root([&poses]<class F>(const orientation<root, F>& ori) {
+        poses[W::template index_of<F>()] = {ori.rotation(), ori.origin()};
+    });
+
+    const auto& to_a = poses[W::template index_of<A>()];
+    const auto q_a = to_a.rotation.conjugate();
+
+    auto out = point_jacobian<A, sizeof...(Joints)>{};
+
+    std::visit(
+        [&]<class F>(const position<F>& r_f) {
+            const auto& to_f = poses[W::template index_of<F>()];
+            const auto r = to_f.origin +
+                           detail::rotated<position<root>>(to_f.rotation, r_f);
+
+            auto i = std::size_t{};
+            const auto column = [&]<class P, class C>(
+                                    const revolute<P, C>& joint) {
+                static_assert(std::is_same_v<detail::parent_of_t<W, C>, P>,
+                              "joint must relate a frame to its parent");
+
+                constexpr auto sign =
+                    int{detail::on_path_v<W, F, C>} -
+                    int{detail::on_path_v<W, A, C>};
+
+                if constexpr (sign != 0) {
+                    const auto& to_p = poses[W::template index_of<P>()];
+                    const auto& to_c = poses[W::template index_of<C>()];
+
+                    const auto a =
+                        T{sign} * detail::rotated<V>(to_p.rotation, joint.axis);
+                    const auto d = std::bit_cast<V>(r - to_c.origin);
+
+                    out.position[i] = detail::rotated<typename A::vector>(
+                        q_a, cross_product(a, d));
+                    out.orientation[i] =
+                        detail::rotated<typename A::vector>(q_a, a);
+                }
+                ++i;
+            };
+            (column(joints), ...);
+        },
+        p.position());
+
+    return out;
+}
+
+}  // namespace turtle
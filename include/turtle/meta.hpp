@@ -132,7 +132,7 @@ struct tree {
         std::is_same<metal::true_, metal::contains<flatten<type>, Node>>;
 
     template <class Node>
-    static constexpr auto contains_v = contains<Node>::value;
+    static constexpr bool contains_v = contains<Node>::value;
 
     template <class Node>
     using path_to_t = std::enable_if_t<contains_v<Node>, path_to<tree, Node>>;
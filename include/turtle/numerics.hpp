@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cmath>
+
+/// @brief Numerical evaluation policies
+///
+/// A policy is selected per reference frame, e.g. `frame<"A", double,
+/// checks::debug, numerics::fast>`, and controls how `norm` and `normalized`
+/// evaluate vectors bound to that frame. Frames use
+/// `numerics::default_policy_t<T>` unless a policy is given, which may be
+/// changed for a scalar type by specializing `numerics::default_policy`.
+namespace turtle::numerics {
+
+/// @brief Evaluates norms with `hypot`
+///
+/// Scales the components to avoid overflow and underflow of intermediate
+/// squares, which keeps norms of very large or very small vectors accurate.
+struct safe {
+    /// @brief Calculates the norm of a vector
+    template <class V>
+    [[nodiscard]] static constexpr auto norm(const V& v) ->
+        typename V::scalar
+    {
+        using std::hypot;
+        return hypot(v.x(), v.y(), v.z());
+    }
+
+    /// @brief Normalizes a vector, returning the zero vector unchanged
+    template <class V>
+    [[nodiscard]] static constexpr auto normalized(const V& v) -> V
+    {
+        if (V{} == v) {
+            return v;
+        }
+        return v / norm(v);
+    }
+};
+
+/// @brief Evaluates norms with the square root of the sum of squares
+///
+/// Several times faster than `safe` and free of branches, allowing loops to be
+/// vectorized. Squares of components with magnitudes above about 1e154 or
+/// below about 1e-154 (for `double`) overflow or underflow.
+struct fast {
+    /// @brief Calculates the norm of a vector
+    template <class V>
+    [[nodiscard]] static constexpr auto norm(const V& v) ->
+        typename V::scalar
+    {
+        using std::sqrt;
+        return sqrt(v.x() * v.x() + v.y() * v.y() + v.z() * v.z());
+    }
+
+    /// @brief Normalizes a vector, returning the zero vector unchanged
+    ///
+    /// Multiplies by the reciprocal norm, which is selected to be zero for the
+    /// zero vector instead of branching.
+    template <class V>
+    [[nodiscard]] static constexpr auto normalized(const V& v) -> V
+    {
+        using T = typename V::scalar;
+        using std::sqrt;
+
+        const auto n2 = v.x() * v.x() + v.y() * v.y() + v.z() * v.z();
+        const auto k = n2 > T{} ? T{1} / sqrt(n2) : T{};
+        return k * v;
+    }
+};
+
+/// @brief Selects the default numerics policy of a scalar type
+/// @tparam T Scalar type
+///
+/// Specialize to change the policy of frames not specifying one, e.g.
+/// ```
+/// template <>
+/// struct turtle::numerics::default_policy<float> {
+///     using type = turtle::numerics::fast;
+/// };
+/// ```
+template <class T>
+struct default_policy {
+    using type = safe;  ///< Numerics policy
+};
+
+/// @brief Default numerics policy of a scalar type
+template <class T>
+using default_policy_t = typename default_policy<T>::type;
+
+}  // namespace turtle::numerics
@@ -1,23 +1,67 @@
 #pragma once
 
+#include "acceleration.hpp"
+#include "checks.hpp"
+#include "euler.hpp"
 #include "fwd.hpp"
+#include "position.hpp"
 #include "quaternion.hpp"
+#include "rotation_matrix.hpp"
 #include "vector_ops.hpp"
 #include "velocity.hpp"
 
 #include "fmt/format.h"
 
+#include <bit>
+#include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <span>
 #include <utility>
 
 namespace turtle {
 
+namespace detail {
+
+/// @brief Rotates the components of a vector as if by `rotate(v, q)`
+/// @tparam Out Result vector type
+/// @param q Unit quaternion, not checked
+/// @param v Vector value
+///
+/// Uses `v + w t + u × t` with `t = 2 u × v`, where `w` and `u` are the scalar
+/// and vector parts of `q`, instead of two quaternion products.
+template <class Out, class T, class V>
+constexpr auto rotated(const quaternion<T>& q, const V& v) -> Out
+{
+    const auto tx = T{2} * (q.y() * v.z() - q.z() * v.y());
+    const auto ty = T{2} * (q.z() * v.x() - q.x() * v.z());
+    const auto tz = T{2} * (q.x() * v.y() - q.y() * v.x());
+
+    return {v.x() + q.w() * tx + (q.y() * tz - q.z() * ty),
+            v.y() + q.w() * ty + (q.z() * tx - q.x() * tz),
+            v.z() + q.w() * tz + (q.x() * ty - q.y() * tx)};
+}
+
+}  // namespace detail
+
+/// @brief Rotation axis and angle of an orientation
+/// @tparam F Frame of the rotation axis
+template <kinematic::frame F>
+struct axis_angle_pair {
+    /// @brief Unit rotation axis, or the zero vector for a zero angle
+    typename F::vector axis{};
+    /// @brief Rotation angle
+    typename F::scalar angle{};
+};
+
 /// @brief An orientation relating two reference frames
 /// @tparam From Source reference frame
 /// @tparam To Destination reference frame
 ///
 /// Specifies the orientation of frame `To` relative frame `From` with a single
-/// angle-axis rotation.
+/// angle-axis rotation, and optionally the position of the origin of `To`
+/// relative the origin of `From`. Together, these form a rigid transform.
+/// Frames related by an orientation without a set origin share an origin.
 template <kinematic::frame From, kinematic::frame To>
 requires std::same_as<typename From::scalar, typename To::scalar>
 class orientation {
@@ -45,11 +89,11 @@ class orientation {
     /// @brief Constructs an orientation from a quaternion between frame `From`
     /// and frame `To`
     /// @param rot Quaternion rotation starting at `From` to align with `To`
-    /// @pre `rot` is normalized
+    /// @pre `rot` is normalized, checked with the policy of `From`
     explicit constexpr orientation(quaternion rot) : rotation_{std::move(rot)}
     {
-        assert(MAX_NORMALIZED_ULP_DIFF >=
-               util::ulp_diff(scalar{1}, rotation_.squared_norm()));
+        checks::normalized<typename From::check_policy>(
+            rotation_.squared_norm());
     }
 
     /// @brief Constructs an orientation from an angle and an axis between frame
@@ -60,13 +104,60 @@ class orientation {
         : rotation_{std::move(angle), std::move(axis)}
     {}
 
+    /// @brief Constructs an orientation from a direction cosine matrix
+    /// @param m Matrix converting vectors from `From` to `To`
+    /// @pre `m` is close to orthonormal with determinant 1, not checked
+    ///
+    /// The recovered rotation is normalized, so that small errors in `m` do
+    /// not violate the unit norm check.
+    /// @see rotation_matrix::rotation
+    explicit orientation(const rotation_matrix<From, To>& m)
+        : rotation_{m.rotation()}
+    {}
+
+    /// @brief Constructs the orientation with the smallest rotation angle
+    /// relating a direction expressed in both frames
+    /// @param u Direction expressed in `From`
+    /// @param v The same direction expressed in `To`
+    /// @post `rotate(u)` is parallel to `v`
+    ///
+    /// Aligns, for example, a measured direction of gravity with a known one.
+    /// The rotation about the direction is left undetermined and chosen to be
+    /// zero.
+    /// @see quaternion::quaternion(const V&, const V&)
+    orientation(const typename From::vector& u, const typename To::vector& v)
+        : rotation_{std::bit_cast<typename From::vector>(v), u}
+    {}
+
+    /// @brief Constructs an orientation from Euler angles
+    /// @param angles Euler angles rotating `From` to align with `To`
+    ///
+    /// Calculates the rotation in closed form, without composing an
+    /// orientation for each angle.
+    template <euler_sequence Seq, euler_axes Axes>
+    explicit orientation(const euler_angles<Seq, Axes, scalar>& angles)
+        : rotation_{angles.rotation()}
+    {}
+
+    /// @brief Constructs an orientation from Euler angles and their rates
+    /// @param angles Euler angles rotating `From` to align with `To`
+    /// @param rates Rates of change of `angles`
+    /// @see euler_angles::angular_velocity
+    template <euler_sequence Seq, euler_axes Axes>
+    orientation(const euler_angles<Seq, Axes, scalar>& angles,
+                const euler_angles<Seq, Axes, scalar>& rates)
+        : rotation_{angles.rotation()},
+          ang_vel_{angles.template angular_velocity<From>(rates)}
+    {}
+
     /// @brief Obtains the rotation angle
     /// @note This performs an internal calculation and may be sensitive to
     /// numerical stability issues.
     [[nodiscard]] auto angle() const -> scalar
     {
         // https://en.wikipedia.org/wiki/Quaternions_and_spatial_rotation#Recovering_the_axis-angle_representation
-        return scalar{2} * std::atan2(norm(vector_part()), rotation_.w());
+        using std::atan2;
+        return scalar{2} * atan2(norm(vector_part()), rotation_.w());
     }
 
     /// @brief Obtains the rotation axis
@@ -77,12 +168,40 @@ class orientation {
         return normalized(vector_part());
     }
 
+    /// @brief Obtains the rotation axis and angle
+    ///
+    /// Equivalent to `axis()` and `angle()`, but calculates the norm of the
+    /// vector part once and with a single square root instead of `hypot`.
+    /// Components of unit quaternions cannot overflow, so the scaling done by
+    /// `hypot` is unnecessary.
+    [[nodiscard]] auto axis_angle() const -> axis_angle_pair<From>
+    {
+        using std::atan2;
+        using std::sqrt;
+
+        const auto v = vector_part();
+        const auto n = sqrt(v.x() * v.x() + v.y() * v.y() + v.z() * v.z());
+        const auto k = n == scalar{} ? scalar{} : scalar{1} / n;
+
+        return {k * v, scalar{2} * atan2(n, rotation_.w())};
+    }
+
     /// @brief Obtains the rotation as a quaternion
     [[nodiscard]] constexpr auto rotation() const& noexcept -> const quaternion&
     {
         return rotation_;
     }
 
+    /// @brief Corrects the norm drift of the rotation quaternion
+    /// @see quaternion::renormalized
+    [[nodiscard]] constexpr auto renormalized() const -> orientation
+    {
+        return orientation{rotation_.renormalized()}
+            .with(ang_vel_)
+            .with(ang_acc_)
+            .with(origin_);
+    }
+
     /// @brief Sets the angular velocity of frame `To` with respect to frame
     /// `From`
     /// @note Requires expression in frame `From`
@@ -104,13 +223,108 @@ class orientation {
         return ang_vel_;
     }
 
+    /// @brief Sets the angular acceleration of frame `To` with respect to
+    /// frame `From`
+    /// @note Requires expression in frame `From`
+    /// @note `integrate` ignores the angular acceleration and keeps it
+    /// unchanged.
+    /// @{
+    constexpr auto with(acceleration<From> a) & -> orientation&
+    {
+        ang_acc_ = std::move(a);
+        return *this;
+    }
+    constexpr auto with(acceleration<From> a) && -> orientation&&
+    {
+        return std::move(with(std::move(a)));
+    }
+    /// @}
+
+    [[nodiscard]] constexpr auto angular_acceleration() const& noexcept
+        -> const acceleration<From>&
+    {
+        return ang_acc_;
+    }
+
+    /// @brief Sets the position of the origin of frame `To` relative the
+    /// origin of frame `From`
+    /// @note Requires expression in frame `From`
+    /// @note Origins are fixed relative each other. `integrate` only changes
+    /// the rotation.
+    /// @{
+    constexpr auto with(position<From> r) & -> orientation&
+    {
+        origin_ = std::move(r);
+        return *this;
+    }
+    constexpr auto with(position<From> r) && -> orientation&&
+    {
+        return std::move(with(std::move(r)));
+    }
+    /// @}
+
+    /// @brief Obtains the position of the origin of frame `To` relative the
+    /// origin of frame `From`
+    [[nodiscard]] constexpr auto origin() const& noexcept
+        -> const position<From>&
+    {
+        return origin_;
+    }
+
+    /// @brief Advances the orientation in time at constant angular velocity
+    /// @param dt Time step
+    ///
+    /// Rotates frame `To` by `angular_velocity() * dt` using the exponential
+    /// map, which is exact for a constant angular velocity. The result is
+    /// renormalized so that norm drift does not accumulate over many steps.
+    /// @{
+    auto integrate(scalar dt) & -> orientation&
+    {
+        const auto h = dt / scalar{2};
+        const auto dq = exp(quaternion{
+            scalar{}, h * ang_vel_.x(), h * ang_vel_.y(), h * ang_vel_.z()});
+
+        rotation_ = (dq * rotation_).renormalized();
+        checks::normalized<typename From::check_policy>(
+            rotation_.squared_norm());
+        return *this;
+    }
+    auto integrate(scalar dt) && -> orientation&&
+    {
+        return std::move(integrate(std::move(dt)));
+    }
+    /// @}
+
+    /// @brief Obtains the orientation advanced in time at constant angular
+    /// velocity
+    /// @param dt Time step
+    /// @see integrate
+    [[nodiscard]] auto integrated(scalar dt) const -> orientation
+    {
+        return orientation{*this}.integrate(dt);
+    }
+
     /// @brief Calculates the inverse orientation starting at `To` and ending at
     /// `From`
     [[nodiscard]] constexpr auto inverse() const -> orientation<To, From>
     {
-        return orientation<To, From>{rotation_.conjugate()}.with(
-            -std::bit_cast<velocity<To>>(
-                angular_velocity().template express_in<To>(*this)));
+        const auto q = rotation_.conjugate();
+
+        // The derivative of -ang_vel_ observed in `To` is equal to that
+        // observed in `From` as ang_vel_ × ang_vel_ = 0
+        return orientation<To, From>{q}
+            .with(-detail::rotated<velocity<To>>(q, ang_vel_))
+            .with(-detail::rotated<acceleration<To>>(q, ang_acc_))
+            .with(-detail::rotated<position<To>>(q, origin_));
+    }
+
+    /// @brief Obtains the rotation as a direction cosine matrix
+    ///
+    /// Forming the matrix costs about as much as a single rotation. Keep the
+    /// result when rotating many vectors by the same orientation.
+    [[nodiscard]] constexpr auto matrix() const -> rotation_matrix<From, To>
+    {
+        return rotation_matrix<From, To>{rotation_};
     }
 
     /// @brief Applies the rotation and converts a vector from `From` to `To`
@@ -122,21 +336,94 @@ class orientation {
         return {u.x(), u.y(), u.z()};
     }
 
+    /// @brief Applies the rotation and converts a range of vectors from `From`
+    /// to `To`
+    /// @param in Vectors bound to frame `From`
+    /// @param out Converted vectors
+    ///
+    /// Forms the rotation matrix once and applies it to each vector.
+    /// @see rotation_matrix::rotate
+    constexpr auto rotate(std::span<const typename From::vector> in,
+                          std::span<typename To::vector> out) const -> void
+    {
+        matrix().rotate(in, out);
+    }
+
   private:
+    template <kinematic::frame F, kinematic::frame T>
+    requires std::same_as<typename F::scalar, typename T::scalar>
+    friend class orientation;
+
+    struct unchecked_t {};
+
+    // Constructs an orientation without checking the norm of `rot`
+    constexpr orientation(unchecked_t, quaternion rot)
+        : rotation_{std::move(rot)}
+    {}
+
+    // Composes two orientations without checking the norm of the composed
+    // rotation
+    template <kinematic::frame C>
+    static constexpr auto
+    compose(const orientation& ori1, const orientation<To, C>& ori2)
+        -> orientation<From, C>
+    {
+        using V = typename From::vector;
+        using O = orientation<From, C>;
+
+        const auto& q = ori1.rotation();
+        const auto& w1 = ori1.angular_velocity();
+        const auto w2 = detail::rotated<V>(q, ori2.angular_velocity());
+        const auto a2 = detail::rotated<V>(q, ori2.angular_acceleration());
+
+        // TODO split out angular velocity and allow w_A_B + w_B_C = w_A_C
+        return O{typename O::unchecked_t{}, q * ori2.rotation()}
+            .with(w1 + velocity<From>{w2})
+            .with(ori1.angular_acceleration() +
+                  acceleration<From>{
+                      a2 + cross_product(std::bit_cast<V>(w1), w2)})
+            .with(ori1.origin() +
+                  detail::rotated<position<From>>(q, ori2.origin()));
+    }
+
     /// @brief Composes two orientations with the same intermediate frame
     /// @tparam C Final destination frame
     /// @return An orientation between `From` and `C`
+    /// @pre The composed rotation is normalized, checked with the policy of
+    /// `From`
+    ///
+    /// Composes rotations, angular velocities, angular accelerations and
+    /// origins in a single pass, rotating vectors of `ori2` into `From` without
+    /// forming the inverse of `ori1`. Angular acceleration includes the
+    /// transport term `w_A_B × w_B_C`.
     template <kinematic::frame C>
     friend constexpr auto
     operator*(const orientation& ori1, const orientation<To, C>& ori2)
         -> orientation<From, C>
     {
-        return orientation<From, C>{ori1.rotation() * ori2.rotation()}.with(
-            // TODO split out angular velocity and allow w_A_B + w_B_C = w_A_C
-            ori1.angular_velocity() +
-            std::bit_cast<velocity<From>>(
-                ori2.angular_velocity().template express_in<From>(
-                    ori1.inverse())));
+        auto ori = compose(ori1, ori2);
+        checks::normalized<typename From::check_policy>(
+            ori.rotation().squared_norm());
+        return ori;
+    }
+
+    /// @brief Composes two orientations and corrects the norm drift of the
+    /// composed rotation
+    /// @tparam C Final destination frame
+    /// @return An orientation between `From` and `C`
+    ///
+    /// Equivalent to `(ori1 * ori2).renormalized()`, except that the composed
+    /// rotation is renormalized before it is checked. Used to compose long
+    /// chains, where the product of many rotations may drift beyond the unit
+    /// norm tolerance.
+    /// @see operator*, renormalized
+    template <kinematic::frame C>
+    friend constexpr auto
+    renormalized_product(const orientation& ori1,
+                         const orientation<To, C>& ori2)
+        -> orientation<From, C>
+    {
+        return compose(ori1, ori2).renormalized();
     }
 
     [[nodiscard]] constexpr auto vector_part() const -> typename From::vector
@@ -146,8 +433,105 @@ class orientation {
 
     quaternion rotation_{scalar{1}, scalar{}, scalar{}, scalar{}};
     velocity<From> ang_vel_{};
+    acceleration<From> ang_acc_{};
+    position<From> origin_{};
 };
 
+/// @brief Interpolates between two orientations
+/// @param ori1, ori2 Orientation values
+/// @param t Interpolation parameter, returning `ori1` at 0 and `ori2` at 1
+///
+/// Rotations are interpolated with `slerp`, and angular velocities, angular
+/// accelerations and origins linearly.
+template <kinematic::frame From, kinematic::frame To>
+auto slerp(const orientation<From, To>& ori1,
+           const orientation<From, To>& ori2,
+           typename From::scalar t) -> orientation<From, To>
+{
+    using T = typename From::scalar;
+
+    return orientation<From, To>{
+        slerp(ori1.rotation(), ori2.rotation(), t).renormalized()}
+        .with((T{1} - t) * ori1.angular_velocity() +
+              t * ori2.angular_velocity())
+        .with((T{1} - t) * ori1.angular_acceleration() +
+              t * ori2.angular_acceleration())
+        .with((T{1} - t) * ori1.origin() + t * ori2.origin());
+}
+
+/// @brief Interpolates between two orientations with `nlerp`
+/// @param ori1, ori2 Orientation values
+/// @param t Interpolation parameter, returning `ori1` at 0 and `ori2` at 1
+///
+/// Angular velocities, angular accelerations and origins are interpolated
+/// linearly.
+template <kinematic::frame From, kinematic::frame To>
+auto nlerp(const orientation<From, To>& ori1,
+           const orientation<From, To>& ori2,
+           typename From::scalar t) -> orientation<From, To>
+{
+    using T = typename From::scalar;
+
+    return orientation<From, To>{nlerp(ori1.rotation(), ori2.rotation(), t)}
+        .with((T{1} - t) * ori1.angular_velocity() +
+              t * ori2.angular_velocity())
+        .with((T{1} - t) * ori1.angular_acceleration() +
+              t * ori2.angular_acceleration())
+        .with((T{1} - t) * ori1.origin() + t * ori2.origin());
+}
+
+/// @brief Rotates an orientation by a rotation vector
+/// @param ori Orientation value
+/// @param delta Rotation vector expressed in `From`
+///
+/// Applies `boxplus` to the rotation, matching a step of `integrate` with
+/// `angular_velocity() * dt` equal to `delta`. Angular velocity, angular
+/// acceleration and origin are unchanged.
+/// @see boxplus(const quaternion<typename V::scalar>&, const V&)
+template <kinematic::frame From, kinematic::frame To>
+auto boxplus(const orientation<From, To>& ori,
+             const typename From::vector& delta) -> orientation<From, To>
+{
+    return orientation<From, To>{boxplus(ori.rotation(), delta).renormalized()}
+        .with(ori.angular_velocity())
+        .with(ori.angular_acceleration())
+        .with(ori.origin());
+}
+
+/// @brief Calculates the rotation vector between two orientations
+/// @param ori1, ori2 Orientation values
+/// @return The rotation vector `delta`, expressed in `From`, with the smallest
+/// angle such that `boxplus(ori2, delta)` has the rotation of `ori1`
+/// @see boxminus(const quaternion<typename V::scalar>&, const
+/// quaternion<typename V::scalar>&)
+template <kinematic::frame From, kinematic::frame To>
+auto boxminus(const orientation<From, To>& ori1,
+              const orientation<From, To>& ori2) -> typename From::vector
+{
+    return boxminus<typename From::vector>(ori1.rotation(), ori2.rotation());
+}
+
+/// @brief Obtains the rotation axes and angles of a batch of orientations
+/// @param oris Orientation values
+/// @param axes Receives `oris[i].axis_angle().axis` for each `i`
+/// @param angles Receives `oris[i].axis_angle().angle` for each `i`
+/// @pre All arguments have the same size, checked with the policy of `From`
+/// @see orientation::axis_angle
+template <kinematic::frame From, kinematic::frame To>
+auto axis_angle(std::span<const orientation<From, To>> oris,
+                std::span<typename From::vector> axes,
+                std::span<typename From::scalar> angles) -> void
+{
+    checks::expect<typename From::check_policy>(
+        axes.size() == oris.size() and angles.size() == oris.size());
+
+    for (auto i = std::size_t{}; i != oris.size(); ++i) {
+        const auto [axis, angle] = oris[i].axis_angle();
+        axes[i] = axis;
+        angles[i] = angle;
+    }
+}
+
 }  // namespace turtle
 
 template <class From, class To>
@@ -159,11 +543,12 @@ struct fmt::formatter<turtle::orientation<From, To>>
         using T = typename From::scalar;
 
         auto&& out = ctx.out();
+        const auto [axis, angle] = ori.axis_angle();
 
         format_to(out, "[{}] <- ", To::name);
-        formatter<typename From::vector>::format(ori.axis(), ctx);
+        formatter<typename From::vector>::format(axis, ctx);
         format_to(out, ", θ: ");
-        formatter<T>::format(ori.angle(), ctx);
+        formatter<T>::format(angle, ctx);
 
         return out;
     }
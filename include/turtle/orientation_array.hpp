@@ -0,0 +1,172 @@
+#pragma once
+
+#include "fwd.hpp"
+#include "orientation.hpp"
+
+#include "fmt/format.h"
+#include "fmt/ranges.h"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace turtle {
+
+/// @brief The orientations of a family of frames relative a shared parent
+/// @tparam From Parent reference frame
+/// @tparam To Frame family
+///
+/// Stores the orientation of each member of frame family `To` relative frame
+/// `From` in a single contiguous array. Member `i` is related to `From` by
+/// `(*this)[i]`.
+template <kinematic::frame From, kinematic::frame_array To>
+requires std::same_as<typename From::scalar, typename To::scalar>
+class orientation_array {
+  public:
+    using scalar = typename From::scalar;  ///< Orientation scalar type
+
+    /// @name Kinematic types
+    /// @{
+
+    /// @brief Source frame
+    using source_frame = From;
+
+    /// @brief Destination frame family
+    using dest_frame = To;
+
+    /// @brief Orientation of a single family member
+    using value_type = orientation<From, To>;
+
+    /// @}
+
+    /// @brief Constructs identity orientations for every family member
+    constexpr orientation_array() = default;
+
+    /// @brief Constructs an orientation array from member orientations
+    /// @param members Orientation of each family member
+    explicit constexpr orientation_array(
+        std::array<value_type, To::size> members)
+        : members_{std::move(members)}
+    {}
+
+    /// @brief Obtains the number of family members
+    static constexpr auto size() noexcept -> std::size_t { return To::size; }
+
+    /// @brief Accesses the orientation of a family member
+    /// @param i Member index
+    /// @{
+    constexpr auto operator[](std::size_t i) & noexcept -> value_type&
+    {
+        return members_[i];
+    }
+    constexpr auto operator[](std::size_t i) const& noexcept
+        -> const value_type&
+    {
+        return members_[i];
+    }
+    /// @}
+
+    /// @brief Obtains the orientations of all family members
+    [[nodiscard]] constexpr auto members() const& noexcept
+        -> const std::array<value_type, To::size>&
+    {
+        return members_;
+    }
+
+    /// @name Iterators
+    /// @{
+    constexpr auto begin() noexcept { return members_.begin(); }
+    constexpr auto end() noexcept { return members_.end(); }
+    [[nodiscard]] constexpr auto begin() const noexcept
+    {
+        return members_.begin();
+    }
+    [[nodiscard]] constexpr auto end() const noexcept { return members_.end(); }
+    /// @}
+
+    /// @brief Advances all member orientations in time at constant angular
+    /// velocity
+    /// @param dt Time step
+    /// @see orientation::integrate
+    /// @{
+    auto integrate(scalar dt) & -> orientation_array&
+    {
+        for (auto& ori : members_) {
+            ori.integrate(dt);
+        }
+        return *this;
+    }
+    auto integrate(scalar dt) && -> orientation_array&&
+    {
+        return std::move(integrate(std::move(dt)));
+    }
+    /// @}
+
+    /// @brief Obtains all member orientations advanced in time at constant
+    /// angular velocity
+    /// @param dt Time step
+    /// @see orientation::integrated
+    [[nodiscard]] auto integrated(scalar dt) const -> orientation_array
+    {
+        return orientation_array{*this}.integrate(dt);
+    }
+
+    /// @brief Composes an orientation with the orientation of every family
+    /// member
+    /// @param ori Orientation of the parent frame `From` relative frame `P`
+    /// @return Orientation of each family member relative frame `P`
+    ///
+    /// Composes `ori` once per member without recomputing the path to the
+    /// parent frame.
+    template <kinematic::frame P>
+    [[nodiscard]] friend constexpr auto
+    operator*(const orientation<P, From>& ori, const orientation_array& arr)
+        -> std::array<orientation<P, To>, To::size>
+    {
+        auto composed = std::array<orientation<P, To>, To::size>{};
+        for (auto i = std::size_t{}; i != To::size; ++i) {
+            composed[i] = ori * arr.members_[i];
+        }
+        return composed;
+    }
+
+  private:
+    std::array<value_type, To::size> members_{};
+};
+
+}  // namespace turtle
+
+namespace fmt {
+
+template <class From, class To, class Char>
+struct is_range<turtle::orientation_array<From, To>, Char> : std::false_type {};
+
+template <class From, class To>
+struct formatter<turtle::orientation_array<From, To>>
+    : formatter<typename From::vector> {
+    template <class FormatContext>
+    auto
+    format(const turtle::orientation_array<From, To>& arr, FormatContext& ctx)
+    {
+        using T = typename From::scalar;
+
+        auto&& out = ctx.out();
+
+        for (auto i = std::size_t{}; i != arr.size(); ++i) {
+            if (i != 0) {
+                format_to(out, "\n");
+            }
+            const auto [axis, angle] = arr[i].axis_angle();
+
+            format_to(out, "[{}[{}]] <- ", To::name, i);
+            formatter<typename From::vector>::format(axis, ctx);
+            format_to(out, ", θ: ");
+            formatter<T>::format(angle, ctx);
+        }
+
+        return out;
+    }
+};
+
+}  // namespace fmt
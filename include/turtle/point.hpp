@@ -1,13 +1,16 @@
 #pragma once
 
+#include "acceleration.hpp"
 #include "fwd.hpp"
 #include "position.hpp"
+#include "util/trace.hpp"
 #include "velocity.hpp"
 #include "world.hpp"
 
 #include "fmt/format.h"
 
 #include <type_traits>
+#include <utility>
 #include <variant>
 
 namespace turtle {
@@ -17,18 +20,22 @@ namespace turtle {
 /// @note Unlike `vector`, a `point` is bound to a single world.
 template <kinematic::world World>
 class point {
+    // Frame families are excluded as a point is expressed in a single frame
+    using frames = metal::remove_if<meta::flatten<typename World::tree>,
+                                    metal::trait<is_frame_array>>;
+
     using position_variant =
         metal::apply<metal::lambda<std::variant>,
-                     metal::transform<metal::lambda<turtle::position>,
-                                      meta::flatten<typename World::tree>>>;
+                     metal::transform<metal::lambda<turtle::position>, frames>>;
 
-    using velocity_variant = metal::cascade<
-        metal::combine<meta::flatten<typename World::tree>, metal::number<2>>,
-        metal::lambda<std::variant>,
-        metal::lambda<turtle::velocity>>;
+    using velocity_variant =
+        metal::cascade<metal::combine<frames, metal::number<2>>,
+                       metal::lambda<std::variant>,
+                       metal::lambda<turtle::velocity>>;
 
     template <kinematic::frame F>
-    static constexpr auto in_world_v = World::tree::template contains_v<F>;
+    static constexpr auto in_world_v =
+        World::tree::template contains_v<F> and not is_frame_array_v<F>;
 
   public:
     /// @name Kinematic types
@@ -47,7 +54,7 @@ class point {
     /// @tparam F Reference frame
     /// @tparam B Velocity observation frame
     /// @tparam B Velocity expression frame
-    /// @param r Displacement from the origin expressed in `F`
+    /// @param r Displacement from the origin of `F` expressed in `F`
     /// @param v Velocity observed in `B` and expressed in `E`
     ///
     /// Sets the position of this point in the world, expressed in `F` and the
@@ -66,7 +73,7 @@ class point {
 
     /// @brief Sets the point's position
     /// @tparam F Reference frame
-    /// @param r Displacement from the origin expressed in `F`
+    /// @param r Displacement from the origin of `F` expressed in `F`
     ///
     /// Sets the position of this point in the world, expressed in `F`.
     /// This position is fixed in `F` which may not be the same as the
@@ -92,8 +99,7 @@ class point {
     [[nodiscard]] constexpr auto position(const world& w) const
         -> turtle::position<F>
     {
-        return std::visit(
-            [&w](const auto& r) { return r.template in<F>(w); }, position());
+        return position_in<F>(w);
     }
 
     template <kinematic::frame B, kinematic::frame E>
@@ -113,29 +119,159 @@ class point {
     [[nodiscard]] constexpr auto velocity(const world& w) const
         -> turtle::velocity<A, F>
     {
-        // TODO update interfaces to remove need to bit cast so much
+        return velocity_in<A, F>(w);
+    }
+
+    /// @brief Position, velocity and acceleration of a point
+    /// @tparam A Observation frame
+    /// @tparam F Expression frame
+    template <kinematic::frame A, kinematic::frame F = A>
+    struct motion_state {
+        /// @brief Position
+        turtle::position<F> position;
+
+        /// @brief Velocity observed in `A`
+        turtle::velocity<A, F> velocity;
+
+        /// @brief Acceleration observed in `A`
+        turtle::acceleration<A, F> acceleration;
+    };
+
+    /// @brief Obtains the point's position, velocity and acceleration
+    /// @tparam A Observation frame
+    /// @tparam F Expression frame
+    /// @param w A world instance
+    ///
+    /// Calculates all three quantities in a single pass, sharing the composed
+    /// orientations. The velocity set for this point is taken to be constant
+    /// in its observation frame `B`. Velocity and acceleration account for
+    /// the rotation of every frame between the world root and `A` or `B`
+    /// about its own origin.
+    ///
+    /// @see velocity(const world&)
+    template <kinematic::frame A, kinematic::frame F = A>
+    requires in_world_v<A> && in_world_v<F>
+    [[nodiscard]] constexpr auto motion(const world& w) const
+        -> motion_state<A, F>
+    {
+        return motion_in<A, F>(w);
+    }
 
-        const auto v_A_B_bar = std::visit(
-            [&w](const auto& v) {
-                return std::bit_cast<turtle::velocity<A>>(
-                    v.template express_in<A>(w));
+    /// @brief Obtains the point's acceleration
+    /// @tparam A Observation frame
+    /// @tparam F Expression frame
+    /// @param w A world instance
+    /// @see motion
+    template <kinematic::frame A, kinematic::frame F = A>
+    requires in_world_v<A> && in_world_v<F>
+    [[nodiscard]] constexpr auto acceleration(const world& w) const
+        -> turtle::acceleration<A, F>
+    {
+        return motion<A, F>(w).acceleration;
+    }
+
+  private:
+    template <kinematic::world>
+    friend class world_ensemble;
+
+    // The following take a source of orientations `s`, where
+    // `s.template express<From, To>()` obtains the orientation of `To`
+    // relative to `From`, e.g. a world or a member of a world ensemble.
+
+    template <kinematic::frame F, class Source>
+    [[nodiscard]] constexpr auto position_in(const Source& s) const
+        -> turtle::position<F>
+    {
+        TURTLE_TRACE_SCOPE(point_position);
+        return std::visit(
+            [&s]<class E>(const turtle::position<E>& r) {
+                return r.in(s.template express<E, F>());
             },
-            velocity_);
+            position());
+    }
+
+    // Motion of this point relative to the world root, where `s` also
+    // provides `s.template moving_from_root<F>()`, the orientation of `F`
+    // relative to the root together with the motion of the origin of `F`
+    struct root_motion {
+        typename World::root::vector position;
+        typename World::root::vector velocity;
+        typename World::root::vector acceleration;
+    };
+
+    template <class Source>
+    [[nodiscard]] constexpr auto root_motion_in(const Source& s) const
+        -> root_motion
+    {
+        using N = typename World::root;
+        using V = typename N::vector;
+        using T = typename N::scalar;
+
+        const auto r = std::bit_cast<V>(position_in<N>(s));
 
-        const auto w_A_B = std::visit(
-            [&w]<class B, class E>(const turtle::velocity<B, E>&) {
-                return w.template express<A, B>().angular_velocity();
+        return std::visit(
+            [&s, &r]<class B, class E>(const turtle::velocity<B, E>& v) {
+                const auto m_B = s.template moving_from_root<B>();
+                const auto v_B = std::bit_cast<V>(
+                    v.express_in(s.template express<E, N>()));
+                const auto w_B =
+                    std::bit_cast<V>(m_B.ori.angular_velocity());
+
+                return root_motion{
+                    r,
+                    v_B + m_B.velocity_at(r),
+                    m_B.acceleration_at(r) +
+                        T{2} * cross_product(w_B, v_B)};
             },
             velocity_);
+    }
+
+    template <kinematic::frame A, kinematic::frame F, class Source>
+    [[nodiscard]] constexpr auto velocity_in(const Source& s) const
+        -> turtle::velocity<A, F>
+    {
+        TURTLE_TRACE_SCOPE(point_velocity);
 
-        return (v_A_B_bar +
-                std::bit_cast<turtle::velocity<A>>(cross_product(
-                    std::bit_cast<typename A::vector>(w_A_B),
-                    std::bit_cast<typename A::vector>(position<A>(w)))))
-            .template express_in<F>(w);
+        using N = typename World::root;
+
+        // Subtract the velocity of the point of `A` coincident with this one
+        const auto m = root_motion_in(s);
+        const auto m_A = s.template moving_from_root<A>();
+
+        return turtle::velocity<A, N>{m.velocity -
+                                      m_A.velocity_at(m.position)}
+            .express_in(s.template express<N, F>());
+    }
+
+    template <kinematic::frame A, kinematic::frame F, class Source>
+    [[nodiscard]] constexpr auto motion_in(const Source& s) const
+        -> motion_state<A, F>
+    {
+        TURTLE_TRACE_SCOPE(point_motion);
+
+        using N = typename World::root;
+        using T = typename N::scalar;
+
+        const auto m = root_motion_in(s);
+        const auto m_A = s.template moving_from_root<A>();
+        const auto w_A = std::bit_cast<typename N::vector>(
+            m_A.ori.angular_velocity());
+
+        // Relative to the point of `A` coincident with this one, including
+        // the Coriolis term of the rotation of `A`
+        const auto v = m.velocity - m_A.velocity_at(m.position);
+        const auto a = m.acceleration - m_A.acceleration_at(m.position) -
+                       T{2} * cross_product(w_A, v);
+
+        const auto ori_N_F = s.template express<N, F>();
+
+        return {
+            turtle::position<N>{m.position}.in(ori_N_F),
+            turtle::velocity<A, N>{v}.express_in(ori_N_F),
+            turtle::acceleration<A, N>{a}.express_in(ori_N_F),
+        };
     }
 
-  private:
     /// Displacement from world origin
     position_variant displacement_{};
 
@@ -150,6 +286,8 @@ struct fmt::formatter<turtle::point<World>>
     template <class FormatContext>
     auto format(const turtle::point<World>& p, FormatContext& ctx)
     {
+        TURTLE_TRACE_SCOPE(format);
+
         // TODO: short form printing for world
         return std::visit(
             [out = ctx.out()](const auto& r) {
@@ -35,12 +35,13 @@ struct position : vector_interface<typename E::scalar, position<E>> {
     /// @tparam To Destination frame
     /// @param ori Orientation of `To` relative the frame associated with this
     /// position
-    /// @return This position expressed in frame `To`
+    /// @return This position relative the origin of `To`, expressed in `To`
     template <kinematic::frame To>
     [[nodiscard]] auto in(const orientation<E, To>& ori) const ->
         typename To::position
     {
-        return ori.rotate(std::bit_cast<typename E::vector>(*this));
+        return ori.rotate(
+            std::bit_cast<typename E::vector>(*this - ori.origin()));
     }
 
     /// @brief Express this position in another frame
@@ -48,12 +49,11 @@ struct position : vector_interface<typename E::scalar, position<E>> {
     /// @tparam World Kinematic world
     /// @param world World instance relating the frame associated with this
     /// position and `To`
-    /// @return This position expressed in frame `To`
+    /// @return This position relative the origin of `To`, expressed in `To`
     template <kinematic::frame To, kinematic::world World>
     [[nodiscard]] auto in(const World& world) const -> typename To::position
     {
-        return world.template express<E, To>().rotate(
-            std::bit_cast<typename E::vector>(*this));
+        return in(world.template express<E, To>());
     }
 
     /// @}
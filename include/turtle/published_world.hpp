@@ -0,0 +1,131 @@
+#pragma once
+
+#include "fwd.hpp"
+#include "orientation.hpp"
+#include "util/seqlock.hpp"
+#include "world.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace turtle {
+
+/// @brief A world shared between a single writer and concurrent readers
+/// @tparam World Kinematic world type
+///
+/// The writer modifies a private working copy of the world and publishes it
+/// with `publish()`. Readers obtain consistent snapshots of the most recently
+/// published world. Readers never block the writer and neither side
+/// allocates.
+///
+/// ~~~cpp
+/// auto shared = published_world<W>{};
+///
+/// // writer thread
+/// shared.update([](W& w) { w.get<N, A>() = orientation<N, A>{angle, N::z}; });
+///
+/// // reader threads
+/// const auto ori = shared.express<N, B>();
+/// ~~~
+template <kinematic::world World>
+class published_world {
+    World working_{};
+    util::seqlock<World> published_{};
+
+  public:
+    using world_type = World;  ///< Published world type
+
+    /// @brief Constructs a published world with identity rotations relating
+    /// frames
+    published_world() = default;
+
+    /// @brief Constructs and publishes a world
+    explicit published_world(const World& w) : working_{w}, published_{w} {}
+
+    published_world(const published_world&) = delete;
+    published_world(published_world&&) = delete;
+    auto operator=(const published_world&) -> published_world& = delete;
+    auto operator=(published_world&&) -> published_world& = delete;
+    ~published_world() = default;
+
+    /// @name Writer interface
+    /// @pre Only called by a single writer thread at a time
+    /// @{
+
+    /// @brief Accesses the writer's working copy of the world
+    ///
+    /// Changes are not visible to readers until `publish()` is called.
+    auto working() noexcept -> World& { return working_; }
+
+    /// @brief Publishes the working copy of the world
+    auto publish() noexcept -> void { published_.store(working_); }
+
+    /// @brief Replaces the working copy of the world and publishes it
+    auto publish(const World& w) noexcept -> void
+    {
+        working_ = w;
+        publish();
+    }
+
+    /// @brief Modifies the working copy of the world and publishes it
+    /// @param fn Invocable with `World&`
+    template <class Fn>
+    auto update(Fn&& fn) -> void
+    {
+        std::forward<Fn>(fn)(working_);
+        publish();
+    }
+
+    /// @}
+
+    /// @name Reader interface
+    /// @{
+
+    /// @brief Attempts to copy the published world
+    /// @param out Receives the published world on success
+    /// @return `false` if the copy overlapped a publish, leaving `out`
+    /// unchanged
+    ///
+    /// This function is wait-free.
+    [[nodiscard]] auto try_snapshot(World& out) const noexcept -> bool
+    {
+        return published_.try_load(out);
+    }
+
+    /// @brief Copies the published world
+    ///
+    /// Retries copies that overlap a publish. A reader only retries while the
+    /// writer is publishing.
+    [[nodiscard]] auto snapshot() const noexcept -> World
+    {
+        return published_.load();
+    }
+
+    /// @brief Obtains the number of publishes, including construction
+    [[nodiscard]] auto version() const noexcept -> std::uint64_t
+    {
+        return published_.version();
+    }
+
+    /// @brief Expresses the orientation from the world root to a destination
+    /// frame in the published world
+    /// @see world::express
+    template <kinematic::frame To>
+    [[nodiscard]] auto express() const
+    {
+        return snapshot().template express<To>();
+    }
+
+    /// @brief Expresses the orientation of one frame relative another in the
+    /// published world
+    /// @see world::express
+    template <kinematic::frame From, kinematic::frame To>
+    [[nodiscard]] auto express() const
+    {
+        return snapshot().template express<From, To>();
+    }
+
+    /// @}
+};
+
+}  // namespace turtle
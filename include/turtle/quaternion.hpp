@@ -1,6 +1,6 @@
 #pragma once
 
-#include "util/ulp_diff.hpp"
+#include "checks.hpp"
 #include "vector.hpp"
 #include "vector_ops.hpp"
 
@@ -8,17 +8,14 @@
 #include "fmt/ranges.h"
 
 #include <array>
-#include <cassert>
 #include <cmath>
+#include <limits>
 #include <numeric>
+#include <span>
 #include <utility>
 
 namespace turtle {
 
-/// @brief Hardcoded library default floating point tolerance limit
-// TODO move to a better location and don't hardcode
-inline constexpr std::size_t MAX_NORMALIZED_ULP_DIFF{4};
-
 /// @brief Limited quaternion type
 /// @tparam T Scalar type
 ///
@@ -68,20 +65,24 @@ class quaternion {
     /// @param angle Rotation angle
     /// @param axis Rotation axis
     ///
-    /// @note This constructor ignores the frame associated with `V`
+    /// @note This constructor ignores the frame associated with `V`, except
+    /// for its checking policy
     /// @pre `axis` is normalized
     template <kinematic::vector V>
     quaternion(T angle, V axis)
-        : quaternion{std::cos(angle / T{2}),
-                     std::move(axis.x()) * std::sin(angle / T{2}),
-                     std::move(axis.y()) * std::sin(angle / T{2}),
-                     std::move(axis.z()) * std::sin(angle / T{2})}
     {
+        using std::cos;
+        using std::sin;
+
+        const auto s = sin(angle / T{2});
+        data_ = {cos(angle / T{2}),
+                 std::move(axis.x()) * s,
+                 std::move(axis.y()) * s,
+                 std::move(axis.z()) * s};
+
         if (angle != T{}) {
-            // TODO Define normalization-bypass ctor
-            // TODO Define tolerance customization point
-            assert(MAX_NORMALIZED_ULP_DIFF >=
-                   util::ulp_diff(T{1}, dot_product(axis, axis)));
+            checks::normalized<typename V::frame::check_policy>(
+                dot_product(axis, axis));
         }
     }
 
@@ -99,6 +100,48 @@ class quaternion {
                      std::move(axis.z())}
     {}
 
+    /// @brief Constructs the unit quaternion with the smallest rotation angle
+    /// that rotates one direction onto another
+    /// @tparam V Kinematic vector type
+    /// @param u Initial direction
+    /// @param v Final direction
+    /// @post `rotate(u, *this)` is parallel to `v`
+    ///
+    /// Normalizes `(|u||v| + u · v, u × v)`, which avoids trigonometric
+    /// functions. Only opposite directions, for which the rotation axis is
+    /// undefined, take a separate branch and rotate about an axis orthogonal
+    /// to `u`.
+    ///
+    /// @note This constructor ignores the frame associated with `V`, except
+    /// for its checking policy
+    /// @pre `u` and `v` are nonzero, checked with the policy of the frame of
+    /// `V`
+    template <kinematic::vector V>
+    quaternion(const V& u, const V& v)
+    {
+        using std::abs;
+        using std::sqrt;
+
+        const auto n = sqrt(dot_product(u, u) * dot_product(v, v));
+        checks::expect<typename V::frame::check_policy>(n > T{});
+
+        const auto w = n + dot_product(u, v);
+
+        if (w > std::numeric_limits<T>::epsilon() * n) {
+            const auto c = cross_product(u, v);
+            data_ = {w, c.x(), c.y(), c.z()};
+        } else if (abs(u.x()) > abs(u.z())) {
+            data_ = {T{}, -u.y(), u.x(), T{}};
+        } else {
+            data_ = {T{}, T{}, -u.z(), u.y()};
+        }
+
+        const auto k = T{1} / sqrt(squared_norm());
+        for (auto& component : data_) {
+            component *= k;
+        }
+    }
+
     /// @brief Calculates the quaternion conjugate
     ///
     /// For unit quaternions, defines an inverse rotation.
@@ -115,6 +158,20 @@ class quaternion {
         return std::inner_product(cbegin(), cend(), cbegin(), T{});
     }
 
+    /// @brief Approximately normalizes a nearly unit quaternion
+    ///
+    /// Applies a single Newton step towards unit norm, scaling the quaternion
+    /// by `(3 - |q|²) / 2`. This avoids a square root and division and roughly
+    /// squares the relative norm error, making it suitable for correcting the
+    /// drift accumulated by composition.
+    ///
+    /// @note This does not normalize quaternions far from unit norm.
+    [[nodiscard]] constexpr auto renormalized() const -> quaternion
+    {
+        const auto s = (T{3} - squared_norm()) / T{2};
+        return {w() * s, x() * s, y() * s, z() * s};
+    }
+
     /// @brief Calculate the Hamilton product of two quaternions
     /// @param q, p Quaternion values
     /// @note The product of two rotation quaternions is equivalent to a
@@ -219,13 +276,249 @@ quaternion(typename V::scalar a, const V& v) -> quaternion<typename V::scalar>;
 template <kinematic::vector V>
 quaternion(const V& v) -> quaternion<typename V::scalar>;
 
+template <kinematic::vector V>
+quaternion(const V& u, const V& v) -> quaternion<typename V::scalar>;
+
 /// @}
 
+/// @brief Calculates the quaternion exponential
+/// @param q Quaternion value
+///
+/// For a pure quaternion `(0, θ/2 u)` with unit vector `u`, this is the unit
+/// quaternion rotating by angle θ about `u`. Small vector parts use a Taylor
+/// expansion of `sin(|v|)/|v|` and `cos(|v|)`.
+/// @see https://en.wikipedia.org/wiki/Quaternion#Exponential,_logarithm,_and_power_functions
+template <class T>
+auto exp(const quaternion<T>& q) -> quaternion<T>
+{
+    using std::cos;
+    using std::exp;
+    using std::sin;
+    using std::sqrt;
+
+    const auto theta2 = q.x() * q.x() + q.y() * q.y() + q.z() * q.z();
+
+    auto c = T{};
+    auto sinc = T{};
+    if (theta2 * theta2 < std::numeric_limits<T>::epsilon()) {
+        c = T{1} - theta2 / T{2} + theta2 * theta2 / T{24};
+        sinc = T{1} - theta2 / T{6} + theta2 * theta2 / T{120};
+    } else {
+        const auto theta = sqrt(theta2);
+        c = cos(theta);
+        sinc = sin(theta) / theta;
+    }
+
+    const auto a = exp(q.w());
+    const auto b = a * sinc;
+    return {a * c, b * q.x(), b * q.y(), b * q.z()};
+}
+
+namespace detail {
+
+// Calculates atan2(|v|, w) / |v| from the squared norm of the vector part
+template <class T>
+auto log_factor(T w, T v2) -> T
+{
+    using std::atan2;
+    using std::sqrt;
+
+    const auto w2 = w * w;
+    if (w > T{} and v2 * v2 < std::numeric_limits<T>::epsilon() * w2 * w2) {
+        const auto r = v2 / w2;
+        return (T{1} - r / T{3} + r * r / T{5}) / w;
+    }
+
+    const auto n = sqrt(v2);
+    return atan2(n, w) / n;
+}
+
+}  // namespace detail
+
+/// @brief Calculates the quaternion logarithm
+/// @param q Quaternion value
+/// @pre `q` is not zero or a negative real number
+///
+/// Inverse of `exp` for vector parts with norm less than π. For a unit
+/// quaternion rotating by angle θ about `u`, this is the pure quaternion
+/// `(0, θ/2 u)`. Vector parts that are small relative to a positive scalar
+/// part use a Taylor expansion of `atan(|v|/w)/|v|`.
+/// @see https://en.wikipedia.org/wiki/Quaternion#Exponential,_logarithm,_and_power_functions
+template <class T>
+auto log(const quaternion<T>& q) -> quaternion<T>
+{
+    using std::log;
+
+    const auto v2 = q.x() * q.x() + q.y() * q.y() + q.z() * q.z();
+    const auto k = detail::log_factor(q.w(), v2);
+
+    return {log(q.w() * q.w() + v2) / T{2}, k * q.x(), k * q.y(), k * q.z()};
+}
+
+/// @brief Applies a rotation vector to a unit quaternion
+/// @param q Unit quaternion
+/// @param delta Rotation vector, with the rotation axis as direction and the
+/// rotation angle as norm
+/// @return `exp((0, delta/2)) * q`
+///
+/// This is the tangent space increment matching the integration of angular
+/// velocity in `orientation::integrate`.
+/// @see boxminus
+template <kinematic::vector V>
+auto boxplus(const quaternion<typename V::scalar>& q, const V& delta)
+    -> quaternion<typename V::scalar>
+{
+    using T = typename V::scalar;
+
+    constexpr auto h = T{1} / T{2};
+    const auto dq =
+        exp(quaternion<T>{T{}, h * delta.x(), h * delta.y(), h * delta.z()});
+    return dq * q;
+}
+
+/// @brief Calculates the rotation vector between two unit quaternions
+/// @tparam V Rotation vector type
+/// @param q, p Unit quaternions
+/// @return The rotation vector `delta` with the smallest angle such that
+/// `boxplus(p, delta)` represents the same rotation as `q`
+///
+/// The scalar part of the logarithm is not calculated.
+/// @see boxplus
+template <kinematic::vector V>
+auto boxminus(const quaternion<typename V::scalar>& q,
+              const quaternion<typename V::scalar>& p) -> V
+{
+    using T = typename V::scalar;
+
+    const auto d = q * p.conjugate();
+    const auto s = d.w() < T{} ? T{-1} : T{1};
+
+    const auto v2 = d.x() * d.x() + d.y() * d.y() + d.z() * d.z();
+    const auto k = T{2} * s * detail::log_factor(s * d.w(), v2);
+
+    return {k * d.x(), k * d.y(), k * d.z()};
+}
+
+/// @brief Spherical linear interpolation of unit quaternions
+/// @param q, p Unit quaternions
+/// @param t Interpolation parameter, returning `q` at 0 and `p` at 1
+///
+/// Interpolates with constant angular rate along the shorter of the two arcs
+/// between the rotations represented by `q` and `p`. The arc angle is computed
+/// with `atan2`, which remains accurate for nearly equal quaternions.
+/// @see https://en.wikipedia.org/wiki/Slerp
+template <class T>
+auto slerp(const quaternion<T>& q, const quaternion<T>& p, T t)
+    -> quaternion<T>
+{
+    using std::atan2;
+    using std::sin;
+    using std::sqrt;
+
+    const auto dot = std::inner_product(q.cbegin(), q.cend(), p.cbegin(), T{});
+    const auto s = (dot < T{}) ? T{-1} : T{1};
+
+    const auto diff = quaternion<T>{q.w() - s * p.w(),
+                                    q.x() - s * p.x(),
+                                    q.y() - s * p.y(),
+                                    q.z() - s * p.z()};
+    const auto sum = quaternion<T>{q.w() + s * p.w(),
+                                   q.x() + s * p.x(),
+                                   q.y() + s * p.y(),
+                                   q.z() + s * p.z()};
+    const auto theta =
+        T{2} * atan2(sqrt(diff.squared_norm()), sqrt(sum.squared_norm()));
+
+    auto a = T{1} - t;
+    auto b = t;
+    if (theta * theta >= std::numeric_limits<T>::epsilon()) {
+        const auto sin_theta = sin(theta);
+        a = sin((T{1} - t) * theta) / sin_theta;
+        b = sin(t * theta) / sin_theta;
+    }
+    b *= s;
+
+    return {a * q.w() + b * p.w(),
+            a * q.x() + b * p.x(),
+            a * q.y() + b * p.y(),
+            a * q.z() + b * p.z()};
+}
+
+/// @brief Normalized linear interpolation of unit quaternions
+/// @param q, p Unit quaternions
+/// @param t Interpolation parameter, returning `q` at 0 and `p` at 1
+///
+/// Linearly interpolates along the shorter of the two arcs between the
+/// rotations represented by `q` and `p` and normalizes the result. The path
+/// matches `slerp` but the angular rate is not constant, with an error that
+/// grows with the arc angle.
+template <class T>
+auto nlerp(const quaternion<T>& q, const quaternion<T>& p, T t)
+    -> quaternion<T>
+{
+    using std::sqrt;
+
+    const auto dot = std::inner_product(q.cbegin(), q.cend(), p.cbegin(), T{});
+
+    const auto a = T{1} - t;
+    const auto b = (dot < T{}) ? -t : t;
+
+    const auto r = quaternion<T>{a * q.w() + b * p.w(),
+                                 a * q.x() + b * p.x(),
+                                 a * q.y() + b * p.y(),
+                                 a * q.z() + b * p.z()};
+    const auto k = T{1} / sqrt(r.squared_norm());
+
+    return {k * r.w(), k * r.x(), k * r.y(), k * r.z()};
+}
+
+/// @brief Approximates `slerp` with `nlerp` and a corrected interpolation
+/// parameter
+/// @param q, p Unit quaternions
+/// @param t Interpolation parameter, returning `q` at 0 and `p` at 1
+///
+/// Adjusts `t` to cancel the angular rate error of `nlerp`, avoiding the
+/// trigonometric functions of `slerp`. The correction is exact to leading
+/// order in the arc angle, with higher order terms fitted numerically. The
+/// rotation angle of the result differs from that of `slerp` by less than
+/// 1e-3 radians and by less than 2e-5 radians for rotations of less than 1
+/// radian, with the error decreasing as the fifth power of the rotation angle.
+/// @see https://zeux.io/2016/05/05/optimizing-slerp/
+template <class T>
+auto fast_slerp(const quaternion<T>& q, const quaternion<T>& p, T t)
+    -> quaternion<T>
+{
+    using std::abs;
+
+    const auto e =
+        T{1} - abs(std::inner_product(q.cbegin(), q.cend(), p.cbegin(), T{}));
+    const auto s = (t - T{0.5}) * (t - T{0.5});
+
+    const auto k =
+        e * (T{2} / T{3} +
+             e * (T{0.121876} + T{0.349399} * s +
+                  e * (T{0.061875} + T{0.683465} * s)));
+
+    return nlerp(q, p, t + t * (t - T{0.5}) * (t - T{1}) * k);
+}
+
+/// @brief Approximately normalizes a range of nearly unit quaternions
+/// @param qs Quaternions, modified in place
+/// @see quaternion::renormalized
+template <class T>
+constexpr auto renormalize(std::span<quaternion<T>> qs) -> void
+{
+    for (auto& q : qs) {
+        q = q.renormalized();
+    }
+}
+
 /// @brief Applies a rotation to a vector
 /// @tparam F Reference frame type
 /// @param v Kinematic vector expressed in frame F
 /// @param qr Rotation quaternion
 /// @return Rotated vector in frame F
+/// @pre `qr` is normalized, checked with the policy of `F`
 /// @see https://en.wikipedia.org/wiki/Rotation_(mathematics)#Quaternions
 template <kinematic::frame F>
 constexpr auto
@@ -237,14 +530,14 @@ rotate(const vector<F>& v, const quaternion<typename F::scalar>& qr)
         return {};
     }
 
-    using T = typename F::scalar;
-    assert(MAX_NORMALIZED_ULP_DIFF >= util::ulp_diff(T{1}, qr.squared_norm()));
+    using Checks = typename F::check_policy;
+    checks::normalized<Checks>(qr.squared_norm());
 
     auto const qo = qr * quaternion{v} * qr.conjugate();
 
     // TODO: use a better check for zero scalar
     // NOLINTNEXTLINE(readability-magic-numbers)
-    assert(1e-10 > (qo.w() * qo.w() / qo.squared_norm()));
+    checks::expect<Checks>(1e-10 > (qo.w() * qo.w() / qo.squared_norm()));
     return {qo.x(), qo.y(), qo.z()};
 }
 
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "checks.hpp"
+#include "fwd.hpp"
+#include "quaternion.hpp"
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace turtle {
+
+/// @brief A structure-of-arrays view of a sequence of quaternions
+/// @tparam T Scalar type, possibly const-qualified
+///
+/// Refers to four equally sized arrays holding the components of each
+/// quaternion. Storing components contiguously allows batch operations to
+/// process several quaternions per instruction.
+template <class T>
+struct quaternion_span {
+    std::span<T> w;  ///< Real components
+    std::span<T> x;  ///< First imaginary components
+    std::span<T> y;  ///< Second imaginary components
+    std::span<T> z;  ///< Third imaginary components
+
+    /// @brief Obtains the number of quaternions
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+    {
+        return w.size();
+    }
+
+    /// @brief Checks if all component arrays have the same size
+    [[nodiscard]] constexpr auto consistent() const noexcept -> bool
+    {
+        return x.size() == w.size() and y.size() == w.size() and
+               z.size() == w.size();
+    }
+
+    /// @brief Obtains a copy of the `i`-th quaternion
+    [[nodiscard]] constexpr auto operator[](std::size_t i) const
+        -> quaternion<std::remove_const_t<T>>
+    {
+        return {w[i], x[i], y[i], z[i]};
+    }
+
+    /// @brief Assigns the `i`-th quaternion
+    constexpr auto set(std::size_t i, const quaternion<T>& q) const -> void
+    requires(not std::is_const_v<T>)
+    {
+        w[i] = q.w();
+        x[i] = q.x();
+        y[i] = q.y();
+        z[i] = q.z();
+    }
+
+    /// @brief Converts to a view of const components
+    constexpr operator quaternion_span<const T>() const noexcept
+    requires(not std::is_const_v<T>)
+    {
+        return {w, x, y, z};
+    }
+};
+
+namespace detail {
+
+template <class T, class Interpolate>
+auto interpolate(quaternion_span<const T> q,
+                 quaternion_span<const T> p,
+                 std::span<const T> t,
+                 quaternion_span<T> out,
+                 Interpolate interp) -> void
+{
+    checks::expect<checks::debug>(
+        q.consistent() and p.consistent() and out.consistent() and
+        p.size() == q.size() and t.size() == q.size() and
+        out.size() == q.size());
+
+    for (auto i = std::size_t{}; i != q.size(); ++i) {
+        out.set(i, interp(q[i], p[i], t[i]));
+    }
+}
+
+}  // namespace detail
+
+/// @brief Spherical linear interpolation of batches of unit quaternions
+/// @param q, p Unit quaternions
+/// @param t Interpolation parameters
+/// @param out Receives `slerp(q[i], p[i], t[i])` for each `i`
+/// @pre All arguments have the same size
+/// @see slerp(const quaternion<T>&, const quaternion<T>&, T)
+template <class T>
+auto slerp(quaternion_span<const std::type_identity_t<T>> q,
+           quaternion_span<const std::type_identity_t<T>> p,
+           std::span<const std::type_identity_t<T>> t,
+           quaternion_span<T> out) -> void
+{
+    detail::interpolate(q, p, t, out, [](const auto& a, const auto& b, T s) {
+        return slerp(a, b, s);
+    });
+}
+
+/// @brief Normalized linear interpolation of batches of unit quaternions
+/// @param q, p Unit quaternions
+/// @param t Interpolation parameters
+/// @param out Receives `nlerp(q[i], p[i], t[i])` for each `i`
+/// @pre All arguments have the same size
+/// @see nlerp(const quaternion<T>&, const quaternion<T>&, T)
+template <class T>
+auto nlerp(quaternion_span<const std::type_identity_t<T>> q,
+           quaternion_span<const std::type_identity_t<T>> p,
+           std::span<const std::type_identity_t<T>> t,
+           quaternion_span<T> out) -> void
+{
+    detail::interpolate(q, p, t, out, [](const auto& a, const auto& b, T s) {
+        return nlerp(a, b, s);
+    });
+}
+
+/// @brief Approximate spherical linear interpolation of batches of unit
+/// quaternions
+/// @param q, p Unit quaternions
+/// @param t Interpolation parameters
+/// @param out Receives `fast_slerp(q[i], p[i], t[i])` for each `i`
+/// @pre All arguments have the same size
+///
+/// Unlike `slerp`, the loop body has no branches or trigonometric function
+/// calls and may be vectorized by the compiler.
+/// @see fast_slerp(const quaternion<T>&, const quaternion<T>&, T)
+template <class T>
+auto fast_slerp(quaternion_span<const std::type_identity_t<T>> q,
+                quaternion_span<const std::type_identity_t<T>> p,
+                std::span<const std::type_identity_t<T>> t,
+                quaternion_span<T> out) -> void
+{
+    detail::interpolate(q, p, t, out, [](const auto& a, const auto& b, T s) {
+        return fast_slerp(a, b, s);
+    });
+}
+
+/// @brief Calculates the exponential of a batch of quaternions
+/// @param q Quaternion values
+/// @param out Receives `exp(q[i])` for each `i`
+/// @pre All arguments have the same size
+/// @see exp(const quaternion<T>&)
+template <class T>
+auto exp(quaternion_span<const std::type_identity_t<T>> q,
+         quaternion_span<T> out) -> void
+{
+    checks::expect<checks::debug>(q.consistent() and out.consistent() and
+                                  out.size() == q.size());
+
+    for (auto i = std::size_t{}; i != q.size(); ++i) {
+        out.set(i, exp(q[i]));
+    }
+}
+
+/// @brief Calculates the logarithm of a batch of quaternions
+/// @param q Quaternion values
+/// @param out Receives `log(q[i])` for each `i`
+/// @pre All arguments have the same size
+/// @see log(const quaternion<T>&)
+template <class T>
+auto log(quaternion_span<const std::type_identity_t<T>> q,
+         quaternion_span<T> out) -> void
+{
+    checks::expect<checks::debug>(q.consistent() and out.consistent() and
+                                  out.size() == q.size());
+
+    for (auto i = std::size_t{}; i != q.size(); ++i) {
+        out.set(i, log(q[i]));
+    }
+}
+
+/// @brief Applies a batch of rotation vectors to unit quaternions
+/// @param q Unit quaternions
+/// @param delta Rotation vectors
+/// @param out Receives `boxplus(q[i], delta[i])` for each `i`
+/// @pre All arguments have the same size
+/// @see boxplus(const quaternion<typename V::scalar>&, const V&)
+template <kinematic::vector V>
+auto boxplus(quaternion_span<const typename V::scalar> q,
+             std::span<const V> delta,
+             quaternion_span<typename V::scalar> out) -> void
+{
+    checks::expect<checks::debug>(q.consistent() and out.consistent() and
+                                  delta.size() == q.size() and
+                                  out.size() == q.size());
+
+    for (auto i = std::size_t{}; i != q.size(); ++i) {
+        out.set(i, boxplus(q[i], delta[i]));
+    }
+}
+
+/// @brief Calculates a batch of rotation vectors between unit quaternions
+/// @param q, p Unit quaternions
+/// @param out Receives `boxminus<V>(q[i], p[i])` for each `i`
+/// @pre All arguments have the same size
+/// @see boxminus(const quaternion<typename V::scalar>&, const
+/// quaternion<typename V::scalar>&)
+template <kinematic::vector V>
+auto boxminus(quaternion_span<const typename V::scalar> q,
+              quaternion_span<const typename V::scalar> p,
+              std::span<V> out) -> void
+{
+    checks::expect<checks::debug>(q.consistent() and p.consistent() and
+                                  p.size() == q.size() and
+                                  out.size() == q.size());
+
+    for (auto i = std::size_t{}; i != q.size(); ++i) {
+        out[i] = boxminus<V>(q[i], p[i]);
+    }
+}
+
+/// @brief Constructs a batch of shortest arc rotations
+/// @param u Initial directions
+/// @param v Final directions
+/// @param out Receives `quaternion{u[i], v[i]}` for each `i`
+/// @pre All arguments have the same size
+/// @see quaternion::quaternion(const V&, const V&)
+template <kinematic::vector V>
+auto shortest_arc(std::span<const V> u,
+                  std::span<const V> v,
+                  quaternion_span<typename V::scalar> out) -> void
+{
+    checks::expect<checks::debug>(out.consistent() and
+                                  u.size() == out.size() and
+                                  v.size() == out.size());
+
+    for (auto i = std::size_t{}; i != out.size(); ++i) {
+        out.set(i, quaternion{u[i], v[i]});
+    }
+}
+
+}  // namespace turtle
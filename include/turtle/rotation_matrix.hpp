@@ -0,0 +1,298 @@
+#pragma once
+
+#include "acceleration.hpp"
+#include "checks.hpp"
+#include "fwd.hpp"
+#include "position.hpp"
+#include "quaternion.hpp"
+#include "quaternion_span.hpp"
+#include "vector.hpp"
+#include "velocity.hpp"
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace turtle {
+
+/// @brief A direction cosine matrix relating two reference frames
+/// @tparam From Source reference frame
+/// @tparam To Destination reference frame
+///
+/// Converts the components of vectors expressed in `From` to components
+/// expressed in `To`, like `orientation::rotate`. Forming the matrix from a
+/// quaternion costs about as much as a single quaternion rotation, but each
+/// subsequent rotation takes 9 multiplications instead of two Hamilton
+/// products, which favors the matrix when many vectors are rotated by the same
+/// rotation.
+template <kinematic::frame From, kinematic::frame To>
+requires std::same_as<typename From::scalar, typename To::scalar>
+class rotation_matrix {
+  public:
+    using scalar = typename From::scalar;  ///< Matrix scalar type
+
+    /// @brief Matrix rows
+    using rows_type = std::array<std::array<scalar, 3>, 3>;
+
+    /// @name Kinematic types
+    /// @{
+
+    /// @brief Quaternion type
+    using quaternion = turtle::quaternion<scalar>;
+
+    /// @brief Source frame
+    using source_frame = From;
+
+    /// @brief Destination frame
+    using dest_frame = To;
+
+    /// @}
+
+    /// @brief Constructs an identity matrix
+    constexpr rotation_matrix() = default;
+
+    /// @brief Constructs a matrix from a unit quaternion
+    /// @param q Quaternion rotation starting at `From` to align with `To`, as
+    /// stored by `orientation`
+    /// @pre `q` is normalized, checked with the policy of `From`
+    explicit constexpr rotation_matrix(const quaternion& q)
+    {
+        checks::normalized<typename From::check_policy>(q.squared_norm());
+
+        const auto xx = q.x() * q.x();
+        const auto yy = q.y() * q.y();
+        const auto zz = q.z() * q.z();
+        const auto xy = q.x() * q.y();
+        const auto xz = q.x() * q.z();
+        const auto yz = q.y() * q.z();
+        const auto wx = q.w() * q.x();
+        const auto wy = q.w() * q.y();
+        const auto wz = q.w() * q.z();
+
+        constexpr auto one = scalar{1};
+        constexpr auto two = scalar{2};
+
+        // transpose of the matrix rotating vectors by `q`
+        rows_ = {{{one - two * (yy + zz), two * (xy + wz), two * (xz - wy)},
+                  {two * (xy - wz), one - two * (xx + zz), two * (yz + wx)},
+                  {two * (xz + wy), two * (yz - wx), one - two * (xx + yy)}}};
+    }
+
+    /// @brief Constructs a matrix from the rotation of an orientation
+    /// @param ori Orientation starting at `From` and ending at `To`
+    /// @see orientation::matrix
+    explicit constexpr rotation_matrix(const orientation<From, To>& ori)
+        : rotation_matrix{ori.rotation()}
+    {}
+
+    /// @brief Constructs a matrix from rows
+    /// @param rows Matrix rows, where row `i` is the `i`-th axis of `To`
+    /// expressed in `From`
+    /// @pre `rows` is orthonormal with determinant 1, not checked
+    explicit constexpr rotation_matrix(rows_type rows) : rows_{std::move(rows)}
+    {}
+
+    /// @brief Obtains the matrix rows
+    [[nodiscard]] constexpr auto rows() const& noexcept -> const rows_type&
+    {
+        return rows_;
+    }
+
+    /// @brief Obtains a matrix element
+    /// @param i Row index
+    /// @param j Column index
+    [[nodiscard]] constexpr auto operator()(std::size_t i, std::size_t j) const
+        -> const scalar&
+    {
+        return rows_[i][j];
+    }
+
+    /// @brief Obtains the rotation as a unit quaternion
+    ///
+    /// Uses Shepperd's method, which recovers the largest quaternion component
+    /// from the trace or a diagonal element and the remaining components from
+    /// sums and differences of off-diagonal elements. The largest component is
+    /// selected with two comparisons and all cases share a single square root.
+    /// The result is normalized by its own norm rather than the selected
+    /// component, so it is a unit quaternion even if `m` is not exactly
+    /// orthonormal.
+    /// @see https://doi.org/10.2514/3.55767b
+    /// @see https://www.geometrictools.com/Documentation/LinearAlgebraicQuaternions.pdf
+    [[nodiscard]] auto rotation() const -> quaternion
+    {
+        using std::sqrt;
+
+        const auto& m = rows_;
+        constexpr auto one = scalar{1};
+
+        auto q = quaternion{};
+        auto t = scalar{};
+        if (m[2][2] < scalar{}) {
+            if (m[0][0] > m[1][1]) {
+                t = one + m[0][0] - m[1][1] - m[2][2];
+                q = {m[1][2] - m[2][1],
+                     t,
+                     m[0][1] + m[1][0],
+                     m[2][0] + m[0][2]};
+            } else {
+                t = one - m[0][0] + m[1][1] - m[2][2];
+                q = {m[2][0] - m[0][2],
+                     m[0][1] + m[1][0],
+                     t,
+                     m[1][2] + m[2][1]};
+            }
+        } else {
+            if (m[0][0] < -m[1][1]) {
+                t = one - m[0][0] - m[1][1] + m[2][2];
+                q = {m[0][1] - m[1][0],
+                     m[2][0] + m[0][2],
+                     m[1][2] + m[2][1],
+                     t};
+            } else {
+                t = one + m[0][0] + m[1][1] + m[2][2];
+                q = {t,
+                     m[1][2] - m[2][1],
+                     m[2][0] - m[0][2],
+                     m[0][1] - m[1][0]};
+            }
+        }
+
+        const auto k = one / sqrt(q.squared_norm());
+        return {k * q.w(), k * q.x(), k * q.y(), k * q.z()};
+    }
+
+    /// @brief Calculates the inverse matrix starting at `To` and ending at
+    /// `From`
+    [[nodiscard]] constexpr auto inverse() const -> rotation_matrix<To, From>
+    {
+        const auto& m = rows_;
+        return rotation_matrix<To, From>{
+            typename rotation_matrix<To, From>::rows_type{
+                {{m[0][0], m[1][0], m[2][0]},
+                 {m[0][1], m[1][1], m[2][1]},
+                 {m[0][2], m[1][2], m[2][2]}}}};
+    }
+
+    /// @name Frame expression operations
+    /// @{
+
+    /// @brief Converts a vector from `From` to `To`
+    /// @param v Vector bound to frame `From`
+    [[nodiscard]] constexpr auto rotate(const typename From::vector& v) const
+        -> typename To::vector
+    {
+        return apply<typename To::vector>(v);
+    }
+
+    /// @brief Expresses a position in `To`
+    /// @param r Position expressed in `From`
+    /// @note Frame origins are not considered.
+    [[nodiscard]] constexpr auto rotate(const position<From>& r) const
+        -> position<To>
+    {
+        return apply<position<To>>(r);
+    }
+
+    /// @brief Expresses a velocity in `To`
+    /// @tparam B Observation frame
+    /// @param v Velocity expressed in `From`
+    template <kinematic::frame B>
+    [[nodiscard]] constexpr auto rotate(const velocity<B, From>& v) const
+        -> velocity<B, To>
+    {
+        return apply<velocity<B, To>>(v);
+    }
+
+    /// @brief Expresses an acceleration in `To`
+    /// @tparam B Observation frame
+    /// @param a Acceleration expressed in `From`
+    template <kinematic::frame B>
+    [[nodiscard]] constexpr auto rotate(const acceleration<B, From>& a) const
+        -> acceleration<B, To>
+    {
+        return apply<acceleration<B, To>>(a);
+    }
+
+    /// @brief Converts a range of vectors from `From` to `To`
+    /// @param in Vectors bound to frame `From`
+    /// @param out Converted vectors, which may alias `in` only if equal
+    /// @pre `in` and `out` have the same size, checked with the policy of
+    /// `From`
+    constexpr auto rotate(std::span<const typename From::vector> in,
+                          std::span<typename To::vector> out) const -> void
+    {
+        checks::expect<typename From::check_policy>(in.size() == out.size());
+
+        for (auto i = std::size_t{}; i != in.size(); ++i) {
+            out[i] = rotate(in[i]);
+        }
+    }
+
+    /// @}
+
+    /// @brief Compares two matrices for element-wise equality
+    friend constexpr auto operator==(const rotation_matrix&,
+                                     const rotation_matrix&) -> bool = default;
+
+  private:
+    /// @brief Composes two matrices with the same intermediate frame
+    /// @tparam C Final destination frame
+    /// @return A matrix between `From` and `C`
+    ///
+    /// Matches the composition order of `orientation`.
+    template <kinematic::frame C>
+    friend constexpr auto
+    operator*(const rotation_matrix& m1, const rotation_matrix<To, C>& m2)
+        -> rotation_matrix<From, C>
+    {
+        const auto& a = m2.rows();
+        const auto& b = m1.rows();
+
+        auto out = typename rotation_matrix<From, C>::rows_type{};
+        for (auto i = std::size_t{}; i != 3; ++i) {
+            for (auto j = std::size_t{}; j != 3; ++j) {
+                out[i][j] =
+                    a[i][0] * b[0][j] + a[i][1] * b[1][j] + a[i][2] * b[2][j];
+            }
+        }
+        return rotation_matrix<From, C>{out};
+    }
+
+    template <class Out, class V>
+    [[nodiscard]] constexpr auto apply(const V& v) const -> Out
+    {
+        const auto& m = rows_;
+        return {m[0][0] * v.x() + m[0][1] * v.y() + m[0][2] * v.z(),
+                m[1][0] * v.x() + m[1][1] * v.y() + m[1][2] * v.z(),
+                m[2][0] * v.x() + m[2][1] * v.y() + m[2][2] * v.z()};
+    }
+
+    rows_type rows_{{{scalar{1}, scalar{}, scalar{}},
+                     {scalar{}, scalar{1}, scalar{}},
+                     {scalar{}, scalar{}, scalar{1}}}};
+};
+
+template <kinematic::frame From, kinematic::frame To>
+rotation_matrix(const orientation<From, To>&) -> rotation_matrix<From, To>;
+
+/// @brief Converts a batch of matrices to unit quaternions
+/// @param m Rotation matrices
+/// @param out Receives `m[i].rotation()` for each `i`
+/// @pre All arguments have the same size, checked with the policy of `From`
+/// @see rotation_matrix::rotation
+template <kinematic::frame From, kinematic::frame To>
+auto to_quaternion(std::span<const rotation_matrix<From, To>> m,
+                   quaternion_span<typename From::scalar> out) -> void
+{
+    checks::expect<typename From::check_policy>(out.consistent() and
+                                                out.size() == m.size());
+
+    for (auto i = std::size_t{}; i != m.size(); ++i) {
+        out.set(i, m[i].rotation());
+    }
+}
+
+}  // namespace turtle
@@ -5,10 +5,17 @@
 /// Defines types for working with kinematics in Cartesian coordinates.
 namespace turtle {}  // namespace turtle
 
+#include "average.hpp"
+#include "dual.hpp"
+#include "euler.hpp"
 #include "frame.hpp"
+#include "inverse_kinematics.hpp"
+#include "jacobian.hpp"
 #include "orientation.hpp"
+#include "orientation_array.hpp"
 #include "point.hpp"
 #include "quaternion.hpp"
+#include "rotation_matrix.hpp"
 #include "vector.hpp"
 #include "vector_ops.hpp"
 #include "world.hpp"
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace turtle::util {
+
+namespace detail {
+
+/// @brief 64-bit FNV-1a hash
+constexpr auto fnv1a(std::string_view s) noexcept -> std::uint64_t
+{
+    // NOLINTBEGIN(readability-magic-numbers)
+    auto h = std::uint64_t{14695981039346656037U};
+    for (const auto c : s) {
+        h ^= static_cast<unsigned char>(c);
+        h *= std::uint64_t{1099511628211U};
+    }
+    return h;
+    // NOLINTEND(readability-magic-numbers)
+}
+
+/// @brief MurmurHash3 64-bit finalizer
+///
+/// A bijection where every input bit affects every output bit, so that
+/// ranges of high bits can be used as independent hash values.
+constexpr auto fmix64(std::uint64_t h) noexcept -> std::uint64_t
+{
+    // NOLINTBEGIN(readability-magic-numbers)
+    h ^= h >> 33U;
+    h *= std::uint64_t{0xFF51AFD7ED558CCDU};
+    h ^= h >> 33U;
+    h *= std::uint64_t{0xC4CEB9FE1A85EC53U};
+    h ^= h >> 33U;
+    return h;
+    // NOLINTEND(readability-magic-numbers)
+}
+
+}  // namespace detail
+
+/// @brief A perfect hash over a fixed set of strings
+/// @tparam N Number of keys
+///
+/// Maps each of `N` distinct keys to its position in the key array with one
+/// string hash, two table loads and one string comparison to reject strings
+/// that are not keys.
+///
+/// Keys are first hashed into buckets. Each bucket then stores a seed for a
+/// second mix of the hash that places its keys in free slots of the table
+/// ("hash and displace"). Seeds are searched for when the hash is
+/// constructed, which is intended to happen at compile time.
+template <std::size_t N>
+class perfect_hash {
+    static constexpr std::size_t buckets = std::max(N, std::size_t{1});
+    static constexpr std::size_t slots = std::bit_ceil(2 * buckets);
+    static constexpr std::size_t empty = N;
+
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    static constexpr auto max_seed = std::uint64_t{1} << 16U;
+
+    std::array<std::string_view, N> keys_;
+    std::array<std::uint64_t, buckets> seeds_{};
+    std::array<std::size_t, slots> table_{};
+    bool valid_{};
+
+    static constexpr auto hash(std::string_view key) noexcept -> std::uint64_t
+    {
+        return detail::fmix64(detail::fnv1a(key));
+    }
+
+    // The bucket is taken from the high half of the hash and the slot from the
+    // top bits of the hash mixed again with the bucket seed
+    static constexpr auto bucket(std::uint64_t h) noexcept -> std::uint64_t
+    {
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        return ((h >> 32U) * buckets) >> 32U;
+    }
+
+    static constexpr auto slot(std::uint64_t h, std::uint64_t seed) noexcept
+        -> std::uint64_t
+    {
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        constexpr auto golden = std::uint64_t{0x9E3779B97F4A7C15U};
+        constexpr auto bits = std::countr_zero(slots);
+
+        return detail::fmix64(h ^ (seed * golden)) >> (64 - bits);
+    }
+
+    // Finds a seed placing keys `keys_[members[k]]`, `k < count`, in distinct
+    // free slots
+    constexpr auto place(const std::array<std::size_t, N>& members,
+                         std::size_t count) -> std::optional<std::uint64_t>
+    {
+        // equal keys share a bucket and can never be separated
+        for (auto k = std::size_t{}; k != count; ++k) {
+            for (auto l = k + 1; l != count; ++l) {
+                if (keys_[members[k]] == keys_[members[l]]) {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        auto hashes = std::array<std::uint64_t, N>{};
+        for (auto k = std::size_t{}; k != count; ++k) {
+            hashes[k] = hash(keys_[members[k]]);
+        }
+
+        auto placed = std::array<std::uint64_t, N>{};
+
+        for (auto seed = std::uint64_t{1}; seed != max_seed; ++seed) {
+            auto fits = true;
+            for (auto k = std::size_t{}; fits and k != count; ++k) {
+                placed[k] = slot(hashes[k], seed);
+                fits = table_[placed[k]] == empty;
+                for (auto l = std::size_t{}; fits and l != k; ++l) {
+                    fits = placed[l] != placed[k];
+                }
+            }
+
+            if (fits) {
+                for (auto k = std::size_t{}; k != count; ++k) {
+                    table_[placed[k]] = members[k];
+                }
+                return seed;
+            }
+        }
+        return std::nullopt;
+    }
+
+  public:
+    /// @brief Constructs a perfect hash over a set of keys
+    /// @param keys Distinct keys
+    ///
+    /// If no perfect hash is found, `valid()` returns `false`. This is always
+    /// the case if keys are not distinct.
+    constexpr explicit perfect_hash(std::array<std::string_view, N> keys)
+        : keys_{keys}
+    {
+        table_.fill(empty);
+
+        auto bucket_of = std::array<std::uint64_t, N>{};
+        auto sizes = std::array<std::size_t, buckets>{};
+        for (auto i = std::size_t{}; i != N; ++i) {
+            bucket_of[i] = bucket(hash(keys_[i]));
+            ++sizes[bucket_of[i]];
+        }
+
+        // place larger buckets first, while the table has more free slots
+        auto members = std::array<std::size_t, N>{};
+        for (auto size = N; size != 0; --size) {
+            for (auto b = std::size_t{}; b != buckets; ++b) {
+                if (sizes[b] != size) {
+                    continue;
+                }
+
+                auto count = std::size_t{};
+                for (auto i = std::size_t{}; i != N; ++i) {
+                    if (bucket_of[i] == b) {
+                        members[count++] = i;
+                    }
+                }
+
+                const auto seed = place(members, count);
+                if (not seed) {
+                    return;
+                }
+                seeds_[b] = *seed;
+            }
+        }
+        valid_ = true;
+    }
+
+    /// @brief Checks if a perfect hash was found for the keys
+    [[nodiscard]] constexpr auto valid() const noexcept -> bool
+    {
+        return valid_;
+    }
+
+    /// @brief Obtains the position of a key
+    /// @param key String value
+    /// @return Position of `key` in the key array, if `key` is a key
+    [[nodiscard]] constexpr auto find(std::string_view key) const noexcept
+        -> std::optional<std::size_t>
+    {
+        const auto h = hash(key);
+        const auto i = table_[slot(h, seeds_[bucket(h)])];
+        if (i != empty and keys_[i] == key) {
+            return i;
+        }
+        return std::nullopt;
+    }
+};
+
+}  // namespace turtle::util
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace turtle::util {
+
+/// @brief Single-writer, multiple-reader sequence lock
+/// @tparam T Trivially copyable value type
+///
+/// Stores a value that one writer thread may replace while any number of
+/// reader threads copy it. The writer never waits for readers and readers
+/// never modify shared state. A read that overlaps a write is detected and
+/// reported as failed, in which case the reader may retry.
+///
+/// The value is stored as an array of atomic words so that overlapping reads
+/// and writes are not data races. No fences are used; on x86 the word accesses
+/// compile to plain loads and stores.
+template <class T>
+requires std::is_trivially_copyable_v<T>
+class seqlock {
+    using word = std::uint64_t;
+    static constexpr std::size_t words =
+        (sizeof(T) + sizeof(word) - 1) / sizeof(word);
+    using buffer = std::array<word, words>;
+
+    std::atomic<std::uint64_t> sequence_{};
+    std::array<std::atomic<word>, words> data_{};
+
+  public:
+    /// @brief Constructs a seqlock holding a value-initialized `T`
+    seqlock() noexcept : seqlock(T{}) {}
+
+    /// @brief Constructs a seqlock holding a value
+    explicit seqlock(const T& value) noexcept { store(value); }
+
+    /// @brief Replaces the stored value
+    /// @pre Only called by a single writer thread at a time
+    auto store(const T& value) noexcept -> void
+    {
+        auto buf = buffer{};
+        std::memcpy(buf.data(), &value, sizeof(T));
+
+        const auto seq = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(seq + 1, std::memory_order_relaxed);
+
+        // release orders the odd sequence number before each word, so a
+        // reader observing any new word also observes the write in progress
+        for (auto i = std::size_t{}; i != words; ++i) {
+            data_[i].store(buf[i], std::memory_order_release);
+        }
+
+        sequence_.store(seq + 2, std::memory_order_release);
+    }
+
+    /// @brief Attempts to copy the stored value
+    /// @param out Receives the stored value on success
+    /// @return `false` if the read overlapped a write, leaving `out` unchanged
+    ///
+    /// This function is wait-free.
+    [[nodiscard]] auto try_load(T& out) const noexcept -> bool
+    {
+        const auto seq = sequence_.load(std::memory_order_acquire);
+        if ((seq & 1U) != 0) {
+            return false;
+        }
+
+        auto buf = buffer{};
+        for (auto i = std::size_t{}; i != words; ++i) {
+            buf[i] = data_[i].load(std::memory_order_acquire);
+        }
+
+        if (seq != sequence_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+
+        std::memcpy(static_cast<void*>(&out), buf.data(), sizeof(T));
+        return true;
+    }
+
+    /// @brief Copies the stored value, retrying reads that overlap a write
+    [[nodiscard]] auto load() const noexcept -> T
+    {
+        auto out = T{};
+        while (not try_load(out)) {
+        }
+        return out;
+    }
+
+    /// @brief Obtains the number of completed writes, including construction
+    [[nodiscard]] auto version() const noexcept -> std::uint64_t
+    {
+        return sequence_.load(std::memory_order_acquire) / 2;
+    }
+};
+
+}  // namespace turtle::util
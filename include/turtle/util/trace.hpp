@@ -0,0 +1,304 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+/// @brief Records per-call latencies for the enclosing scope
+/// @param probe_name Enumerator of `turtle::util::trace::probe`
+///
+/// Expands to nothing unless `TURTLE_ENABLE_TRACING` is defined.
+#ifdef TURTLE_ENABLE_TRACING
+#define TURTLE_TRACE_SCOPE(probe_name)                                         \
+    const ::turtle::util::trace::scope turtle_trace_scope_                     \
+    {                                                                          \
+        ::turtle::util::trace::probe::probe_name                               \
+    }
+#else
+#define TURTLE_TRACE_SCOPE(probe_name) static_cast<void>(0)
+#endif
+
+/// @brief Opt-in latency tracing of kinematic queries
+///
+/// Durations are measured in ticks of `clock()` and recorded into per-thread
+/// histograms. Each histogram has a single writer, the owning thread, and may
+/// be read concurrently by `snapshot()`.
+namespace turtle::util::trace {
+
+/// @brief Whether tracing is compiled in
+#ifdef TURTLE_ENABLE_TRACING
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+/// @brief Instrumented call sites
+enum class probe : std::size_t {
+    world_express,
+    point_position,
+    point_velocity,
+    point_motion,
+    format,
+};
+
+/// @brief Number of instrumented call sites
+inline constexpr std::size_t probe_count =
+    static_cast<std::size_t>(probe::format) + 1;
+
+/// @brief Returns a printable name for a probe
+constexpr auto name(probe p) -> std::string_view
+{
+    constexpr auto names = std::array<std::string_view, probe_count>{
+        "world::express",
+        "point::position",
+        "point::velocity",
+        "point::motion",
+        "format",
+    };
+    return names[static_cast<std::size_t>(p)];
+}
+
+/// @brief Reads the tick counter used for recorded durations
+///
+/// Uses the time-stamp counter on x86 and `std::chrono::steady_clock`
+/// elsewhere.
+inline auto clock() noexcept -> std::uint64_t
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/// @brief Log-linear bucketing of durations
+///
+/// Values below `2^sub_bucket_bits` are counted exactly. Larger values are
+/// grouped by power of two, with each power of two split into
+/// `2^sub_bucket_bits` linear sub-buckets, bounding the relative error of a
+/// recorded value to `2^-sub_bucket_bits`.
+struct buckets {
+    static constexpr std::size_t sub_bucket_bits = 4;
+    static constexpr std::size_t sub_bucket_count = std::size_t{1}
+                                                    << sub_bucket_bits;
+    static constexpr std::size_t count =
+        (std::numeric_limits<std::uint64_t>::digits - sub_bucket_bits + 1) *
+        sub_bucket_count;
+
+    /// @brief Returns the bucket containing value `v`
+    static constexpr auto index(std::uint64_t v) noexcept -> std::size_t
+    {
+        if (v < sub_bucket_count) {
+            return v;
+        }
+        const auto e = static_cast<std::size_t>(
+            std::numeric_limits<std::uint64_t>::digits - 1 -
+            std::countl_zero(v));
+        const std::size_t sub =
+            (v >> (e - sub_bucket_bits)) & (sub_bucket_count - 1);
+        return ((e - sub_bucket_bits + 1) * sub_bucket_count) + sub;
+    }
+
+    /// @brief Returns the smallest value contained in bucket `i`
+    static constexpr auto lower_bound(std::size_t i) noexcept -> std::uint64_t
+    {
+        if (i < sub_bucket_count) {
+            return i;
+        }
+        const auto e = (i / sub_bucket_count) + sub_bucket_bits - 1;
+        const auto sub = i % sub_bucket_count;
+        return std::uint64_t{sub_bucket_count + sub} << (e - sub_bucket_bits);
+    }
+};
+
+/// @brief A single-writer histogram of durations
+class histogram {
+    std::array<std::atomic<std::uint64_t>, buckets::count> counts_{};
+
+  public:
+    /// @brief Adds a sample
+    /// @pre Only called by a single thread
+    auto record(std::uint64_t ticks) noexcept -> void
+    {
+        auto& c = counts_[buckets::index(ticks)];
+        c.store(c.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+    }
+
+    /// @brief Obtains the sample count of bucket `i`
+    [[nodiscard]] auto count(std::size_t i) const noexcept -> std::uint64_t
+    {
+        return counts_[i].load(std::memory_order_relaxed);
+    }
+
+    /// @brief Clears all samples
+    auto reset() noexcept -> void
+    {
+        for (auto& c : counts_) {
+            c.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+/// @brief A point-in-time copy of a histogram, merged across threads
+class histogram_snapshot {
+    std::array<std::uint64_t, buckets::count> counts_{};
+
+  public:
+    /// @brief Adds the samples of a live histogram
+    auto merge(const histogram& h) noexcept -> void
+    {
+        for (auto i = std::size_t{}; i != counts_.size(); ++i) {
+            counts_[i] += h.count(i);
+        }
+    }
+
+    /// @brief Obtains the sample count of bucket `i`
+    [[nodiscard]] auto count(std::size_t i) const noexcept -> std::uint64_t
+    {
+        return counts_[i];
+    }
+
+    /// @brief Obtains the total number of samples
+    [[nodiscard]] auto total() const noexcept -> std::uint64_t
+    {
+        auto n = std::uint64_t{};
+        for (auto c : counts_) {
+            n += c;
+        }
+        return n;
+    }
+
+    /// @brief Obtains the lower bound of the bucket containing quantile `q`
+    /// @param q Quantile in [0, 1]
+    /// @note Returns 0 if there are no samples
+    [[nodiscard]] auto value_at(double q) const noexcept -> std::uint64_t
+    {
+        const auto n = total();
+        if (n == 0) {
+            return 0;
+        }
+        const auto rank = std::max(
+            std::uint64_t{1},
+            static_cast<std::uint64_t>(
+                std::clamp(q, 0., 1.) * static_cast<double>(n) + 0.5));
+
+        auto seen = std::uint64_t{};
+        for (auto i = std::size_t{}; i != counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return buckets::lower_bound(i);
+            }
+        }
+        return buckets::lower_bound(counts_.size() - 1);
+    }
+};
+
+namespace detail {
+
+/// @brief Histograms written by one thread
+///
+/// Nodes are never freed so samples recorded by a thread remain available
+/// after it exits.
+struct thread_histograms {
+    std::array<histogram, probe_count> probes{};
+    thread_histograms* next{};
+};
+
+inline std::atomic<thread_histograms*> registry{};
+
+inline auto local() -> thread_histograms&
+{
+    thread_local auto* const node = [] {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        auto* n = new thread_histograms{};
+        n->next = registry.load(std::memory_order_relaxed);
+        while (not registry.compare_exchange_weak(
+            n->next, n, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        return n;
+    }();
+    return *node;
+}
+
+}  // namespace detail
+
+/// @brief Records a duration for a probe on the calling thread
+inline auto record(probe p, std::uint64_t ticks) -> void
+{
+    detail::local().probes[static_cast<std::size_t>(p)].record(ticks);
+}
+
+/// @brief Merges the histograms of all threads for a probe
+inline auto snapshot(probe p) -> histogram_snapshot
+{
+    auto s = histogram_snapshot{};
+    for (const auto* n = detail::registry.load(std::memory_order_acquire);
+         n != nullptr;
+         n = n->next) {
+        s.merge(n->probes[static_cast<std::size_t>(p)]);
+    }
+    return s;
+}
+
+/// @brief Clears the histograms of all threads
+/// @note Samples recorded concurrently with a reset may be lost
+inline auto reset() -> void
+{
+    for (auto* n = detail::registry.load(std::memory_order_acquire);
+         n != nullptr;
+         n = n->next) {
+        for (auto& h : n->probes) {
+            h.reset();
+        }
+    }
+}
+
+/// @brief Visits a snapshot of every probe
+/// @param fn Invocable with `(probe, const histogram_snapshot&)`
+template <class Fn>
+auto dump(Fn fn) -> void
+{
+    for (auto i = std::size_t{}; i != probe_count; ++i) {
+        const auto p = static_cast<probe>(i);
+        fn(p, snapshot(p));
+    }
+}
+
+/// @brief Measures the lifetime of a scope and records it on destruction
+///
+/// Does nothing during constant evaluation.
+class scope {
+    probe probe_;
+    std::uint64_t start_{};
+
+  public:
+    explicit constexpr scope(probe p) noexcept : probe_{p}
+    {
+        if (not std::is_constant_evaluated()) {
+            start_ = clock();
+        }
+    }
+
+    scope(const scope&) = delete;
+    scope(scope&&) = delete;
+    auto operator=(const scope&) -> scope& = delete;
+    auto operator=(scope&&) -> scope& = delete;
+
+    constexpr ~scope()
+    {
+        if (not std::is_constant_evaluated()) {
+            record(probe_, clock() - start_);
+        }
+    }
+};
+
+}  // namespace turtle::util::trace
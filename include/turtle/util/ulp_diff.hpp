@@ -6,6 +6,7 @@
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace turtle::util {
 
@@ -21,6 +22,25 @@ constexpr auto ulp_diff(const T& t, const T& u) -> std::size_t
 
     return static_cast<std::size_t>(std::abs(i + (a * j)));
 }
+
+template <class Int, class T>
+constexpr auto
+ulp_diff(std::span<const T> ts, const T& u, std::span<std::size_t> out) -> void
+{
+    assert(out.size() >= ts.size());
+
+    // Branch-free loop body to allow auto-vectorization. Non-finite values
+    // are not rejected and result in a large difference.
+    const auto j = std::bit_cast<Int>(std::abs(u));
+    const auto su = std::signbit(u);
+
+    for (auto k = std::size_t{}; k != ts.size(); ++k) {
+        const auto t = ts[k];
+        const auto a = Int{(std::signbit(t) == su) ? -1 : 1};
+        const auto i = std::bit_cast<Int>(std::abs(t));
+        out[k] = static_cast<std::size_t>(std::abs(i + (a * j)));
+    }
+}
 }  // namespace detail
 
 template <class T, class U>
@@ -39,4 +59,27 @@ requires std::same_as<T, U> &&
     return detail::ulp_diff<std::int64_t>(t, u);
 }
 
+/// @brief Calculates the ULP difference of each value in a range to a
+/// reference value
+/// @param ts Values
+/// @param u Reference value
+/// @param out Output range, receiving `ulp_diff(ts[k], u)` at index `k`
+/// @pre `out.size() >= ts.size()`
+/// @note Unlike the scalar overloads, non-finite values are accepted and
+/// result in a large difference.
+template <class T>
+requires(sizeof(std::int32_t) == sizeof(T)) constexpr auto ulp_diff(
+    std::span<const T> ts, const T& u, std::span<std::size_t> out) -> void
+{
+    detail::ulp_diff<std::int32_t>(ts, u, out);
+}
+
+/// @copydoc ulp_diff(std::span<const T>, const T&, std::span<std::size_t>)
+template <class T>
+requires(sizeof(std::int64_t) == sizeof(T)) constexpr auto ulp_diff(
+    std::span<const T> ts, const T& u, std::span<std::size_t> out) -> void
+{
+    detail::ulp_diff<std::int64_t>(ts, u, out);
+}
+
 }  // namespace turtle::util
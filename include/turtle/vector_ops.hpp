@@ -2,7 +2,6 @@
 
 #include "fwd.hpp"
 
-#include <cmath>
 #include <numeric>
 
 namespace turtle {
@@ -36,10 +35,11 @@ constexpr auto cross_product(const V& v, const V& u) -> V
 /// @tparam V Kinematic vector type
 /// @param v Vector value
 /// @return Vector norm as a scalar value
+/// @see numerics
 template <kinematic::vector V>
 constexpr auto norm(const V& v) -> typename V::scalar
 {
-    return std::hypot(v.x(), v.y(), v.z());
+    return V::frame::numerics_policy::norm(v);
 }
 
 /// @brief Returns the normalized vector
@@ -47,13 +47,11 @@ constexpr auto norm(const V& v) -> typename V::scalar
 /// @param v Vector to normalize
 /// @return Vector with the same direction as v but with norm equal to unity
 /// @note If v is the zero vector, the zero vector is returned
+/// @see numerics
 template <kinematic::vector V>
 constexpr auto normalized(const V& v) -> V
 {
-    if (V{} == v) {
-        return v;
-    }
-    return v / norm(v);
+    return V::frame::numerics_policy::normalized(v);
 }
 
 }  // namespace turtle
@@ -1,19 +1,169 @@
 #pragma once
 
+#include "checks.hpp"
 #include "fwd.hpp"
 #include "meta.hpp"
 #include "orientation.hpp"
+#include "orientation_array.hpp"
+#include "util/perfect_hash.hpp"
+#include "util/trace.hpp"
 
 #include "fmt/format.h"
 #include "metal.hpp"
 
+#include <array>
+#include <bit>
+#include <cstddef>
 #include <cstring>
 #include <iterator>
+#include <optional>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
 namespace turtle {
 
+/// @brief Number of compositions between renormalizations in a world
+/// @tparam Root World root frame
+///
+/// When composing orientations along a path, `world` renormalizes the partial
+/// result after every `value` compositions, correcting the norm drift of long
+/// chains before it is checked. A value of 0 disables renormalization.
+/// Specialize this template for a root frame to enable it:
+///
+/// ~~~cpp
+/// template <>
+/// struct turtle::renormalization_period<N>
+///     : std::integral_constant<std::size_t, 8> {};
+/// ~~~
+///
+/// @see renormalized_product
+template <kinematic::frame Root>
+struct renormalization_period : std::integral_constant<std::size_t, 0> {};
+
+/// @brief Helper variable template for `renormalization_period`
+template <kinematic::frame Root>
+inline constexpr std::size_t renormalization_period_v =
+    renormalization_period<Root>::value;
+
+namespace detail {
+
+template <class From, class To>
+struct edge_type {
+    using type = orientation<From, To>;
+};
+
+template <class From, kinematic::frame_array To>
+struct edge_type<From, To> {
+    using type = orientation_array<From, To>;
+};
+
+// An orientation of `To` relative to `From`, together with the velocity and
+// acceleration of the origin of `To` observed in `From` and expressed in
+// `From`. The origin of a single edge is fixed in its source frame, but the
+// origin of a composed orientation moves if an intermediate frame rotates.
+template <class From, class To>
+struct moving_frame {
+    using vector = typename From::vector;
+
+    orientation<From, To> ori{};
+    vector origin_velocity{};
+    vector origin_acceleration{};
+
+    // Velocity, observed in `From`, of the point of `To` at `r`
+    [[nodiscard]] constexpr auto velocity_at(const vector& r) const -> vector
+    {
+        return origin_velocity +
+               cross_product(std::bit_cast<vector>(ori.angular_velocity()),
+                             r - std::bit_cast<vector>(ori.origin()));
+    }
+
+    // Acceleration, observed in `From`, of the point of `To` at `r`
+    [[nodiscard]] constexpr auto acceleration_at(const vector& r) const
+        -> vector
+    {
+        const auto w = std::bit_cast<vector>(ori.angular_velocity());
+        const auto d = r - std::bit_cast<vector>(ori.origin());
+
+        return origin_acceleration +
+               cross_product(std::bit_cast<vector>(ori.angular_acceleration()),
+                             d) +
+               cross_product(w, cross_product(w, d));
+    }
+
+    template <class C>
+    friend constexpr auto
+    operator*(const moving_frame& m1, const moving_frame<To, C>& m2)
+        -> moving_frame<From, C>
+    {
+        return m1.transport(m1.ori * m2.ori, m2);
+    }
+
+    template <class C>
+    friend constexpr auto
+    renormalized_product(const moving_frame& m1, const moving_frame<To, C>& m2)
+        -> moving_frame<From, C>
+    {
+        return m1.transport(renormalized_product(m1.ori, m2.ori), m2);
+    }
+
+  private:
+    // Adds the motion of the origin of `C` due to the rotation of `To`
+    template <class C>
+    constexpr auto transport(orientation<From, C> composed,
+                             const moving_frame<To, C>& m2) const
+        -> moving_frame<From, C>
+    {
+        using T = typename From::scalar;
+
+        const auto& q = ori.rotation();
+        const auto w = std::bit_cast<vector>(ori.angular_velocity());
+        const auto a = std::bit_cast<vector>(ori.angular_acceleration());
+        const auto d = rotated<vector>(q, m2.ori.origin());
+        const auto u = rotated<vector>(q, m2.origin_velocity);
+        const auto w_d = cross_product(w, d);
+
+        return {std::move(composed),
+                origin_velocity + u + w_d,
+                origin_acceleration +
+                    rotated<vector>(q, m2.origin_acceleration) +
+                    T{2} * cross_product(w, u) + cross_product(a, d) +
+                    cross_product(w, w_d)};
+    }
+};
+
+// Composes `ori` with the orientations of every edge on a path of frames,
+// where `edge(std::type_identity<orientation<A, B>>{})` obtains the
+// orientation of the edge from `A` to `B`. The partial result is renormalized
+// after every `renormalization_period_v<Root>` compositions, counted from the
+// end of the path.
+template <class Root, class O, class End, class Edge>
+constexpr auto compose_path(O&& ori, metal::list<End>, const Edge&) -> O&&
+{
+    return std::forward<O>(ori);
+}
+template <class Root, class O, class A, class B, class... Frames, class Edge>
+constexpr auto
+compose_path(O&& ori, metal::list<A, B, Frames...>, const Edge& edge)
+{
+    constexpr auto period = renormalization_period_v<Root>;
+    constexpr auto compositions = sizeof...(Frames) + 1;
+    constexpr auto tag = std::type_identity<orientation<A, B>>{};
+
+    if constexpr (period != 0 and compositions % period == 0) {
+        return renormalized_product(
+            std::forward<O>(ori),
+            compose_path<Root>(
+                edge(tag), metal::list<B, Frames...>{}, edge));
+    } else {
+        return std::forward<O>(ori) *
+               compose_path<Root>(
+                   edge(tag), metal::list<B, Frames...>{}, edge);
+    }
+}
+
+}  // namespace detail
+
 /// @brief A kinematic world
 /// @tparam FrameTree Metatype describing a fixed reference frame topology
 /// @tparam Os Sequence of frame orientations, corresponding to `FrameTree`
@@ -22,7 +172,10 @@ namespace turtle {
 /// instance. This type stores the inter-frame orientations and allows other
 /// kinematic types (e.g. vector, point) to be expressed any contained frame,
 /// applying underlying rotations.
-template <class FrameTree, kinematic::orientation... Os>
+///
+/// A frame family (`frame_array`) is related to its parent by an
+/// `orientation_array` and must be a leaf of the frame tree.
+template <class FrameTree, kinematic::edge... Os>
 requires std::conjunction_v<
     meta::is_specialization_of<FrameTree, meta::tree>,
     std::is_same<typename FrameTree::root,
@@ -30,6 +183,13 @@ requires std::conjunction_v<
     std::conjunction<
         std::is_same<typename FrameTree::root::scalar, typename Os::scalar>...>>
 class world : Os... {
+    static_assert(
+        (not is_frame_array_v<typename Os::source_frame> and ...),
+        "a frame family must be a leaf of the frame tree");
+
+    template <class From, class To>
+    using edge_t = typename detail::edge_type<From, To>::type;
+
   public:
     /// @name Kinematic types
     /// @{
@@ -54,6 +214,7 @@ class world : Os... {
     /// @tparam Args Frame orientation types
     /// @param args Frame orientation values
     template <class... Args>
+    requires(not(std::is_same_v<std::remove_cvref_t<Args>, world> or ...))
     constexpr world(Args&&... args) : Os(std::forward<Args>(args))...
     {}
 
@@ -63,35 +224,203 @@ class world : Os... {
     ///
     /// Accesses the orientation relationship between a source frame and
     /// destination frame, where source is defined to be close the world root.
+    /// If `To` is a frame family, accesses the `orientation_array` of its
+    /// members.
     template <class From, class To>
-    constexpr auto get() & noexcept -> orientation<From, To>&
+    constexpr auto get() & noexcept -> edge_t<From, To>&
     {
-        return static_cast<orientation<From, To>&>(*this);
+        return static_cast<edge_t<From, To>&>(*this);
     }
 
     /// @copydoc get
     template <class From, class To>
     [[nodiscard]] constexpr auto get() const& noexcept
-        -> const orientation<From, To>&
+        -> const edge_t<From, To>&
     {
-        return static_cast<const orientation<From, To>&>(*this);
+        return static_cast<const edge_t<From, To>&>(*this);
     }
 
+    /// @brief Advances all orientations in time at constant angular velocity
+    /// @param dt Time step
+    ///
+    /// Integrates every orientation in this world in a single pass, using the
+    /// angular velocity stored with each orientation.
+    /// @see orientation::integrate
+    /// @{
+    auto integrate(scalar dt) & -> world&
+    {
+        (static_cast<Os&>(*this).integrate(dt), ...);
+        return *this;
+    }
+    auto integrate(scalar dt) && -> world&&
+    {
+        return std::move(integrate(std::move(dt)));
+    }
+    /// @}
+
   private:
-    template <class O, class End>
-    [[nodiscard]] constexpr auto compose_path(O&& ori, metal::list<End>) const
-        -> O&&
+    using frames = meta::flatten<tree>;
+
+    static constexpr auto frame_names =
+        []<class... Fs>(metal::list<Fs...>) {
+            return std::array<std::string_view, sizeof...(Fs)>{Fs::name...};
+        }(frames{});
+
+    // Searched for only when a frame is looked up by name
+    template <std::size_t Size = frame_names.size()>
+    static constexpr auto name_hash = util::perfect_hash<Size>{frame_names};
+
+    template <class Fn, class... Fs>
+    static constexpr auto
+    visit_frame(std::size_t i, Fn&& fn, metal::list<Fs...>) -> decltype(auto)
     {
-        return std::forward<O>(ori);
+        using R = std::invoke_result_t<Fn, meta::first_t<Fs...>>;
+        static_assert(
+            (std::is_same_v<R, std::invoke_result_t<Fn, Fs>> and ...),
+            "visitor must return the same type for every frame");
+
+        constexpr auto table = std::array<R (*)(Fn&&), sizeof...(Fs)>{
+            [](Fn&& f) -> R { return std::forward<Fn>(f)(Fs{}); }...};
+
+        return table[i](std::forward<Fn>(fn));
     }
-    template <class O, class A, class B, class... Frames>
-    [[nodiscard]] constexpr auto
-    compose_path(O&& ori, metal::list<A, B, Frames...>) const
+
+  public:
+    /// @brief Number of frames in this world
+    ///
+    /// A frame family counts as a single frame.
+    static constexpr std::size_t frame_count = frame_names.size();
+
+    /// @brief Obtains the index of a frame
+    /// @tparam F Frame type
+    ///
+    /// Frames are indexed in depth-first order of the frame tree, starting
+    /// with the root at index 0.
+    template <kinematic::frame F>
+    requires tree::template contains_v<F>
+    static constexpr auto index_of() noexcept -> std::size_t
     {
-        return std::forward<O>(ori) *
-               compose_path(get<A, B>(), metal::list<B, Frames...>{});
+        return metal::find<frames, F>::value;
+    }
+
+    /// @brief Obtains the index of a frame from its name
+    /// @param name Frame name
+    /// @return Frame index, if this world contains a frame named `name`
+    ///
+    /// Uses a perfect hash of frame names generated at compile time. A lookup
+    /// compares `name` with at most one frame name.
+    /// @see index_of
+    static constexpr auto find(std::string_view name) noexcept
+        -> std::optional<std::size_t>
+    {
+        static_assert(name_hash<>.valid(), "frame names must be unique");
+        return name_hash<>.find(name);
+    }
+
+    /// @brief Invokes a function with a frame selected at runtime
+    /// @param i Frame index
+    /// @param fn Function invoked with a default constructed value of the
+    /// frame type with index `i`
+    /// @return Result of `fn`, which must have the same type for every frame
+    /// @pre `i < frame_count`
+    ///
+    /// Dispatches through a table of function pointers indexed by `i`.
+    /// @see index_of
+    template <class Fn>
+    static constexpr auto visit_frame(std::size_t i, Fn&& fn) -> decltype(auto)
+    {
+        checks::expect<checks::debug>(i < frame_count);
+        return visit_frame(i, std::forward<Fn>(fn), frames{});
+    }
+
+    /// @brief Invokes a function with a frame selected at runtime by name
+    /// @param name Frame name
+    /// @param fn Function invoked with a default constructed value of the
+    /// frame type named `name`
+    /// @return `true` if this world contains a frame named `name`, otherwise
+    /// `false` and `fn` is not invoked
+    /// @see find
+    template <class Fn>
+    static constexpr auto visit_frame(std::string_view name, Fn&& fn) -> bool
+    {
+        const auto i = find(name);
+        if (i) {
+            visit_frame(*i, std::forward<Fn>(fn));
+        }
+        return i.has_value();
+    }
+
+  private:
+    // Composes `edge(get<A, B>())` for every edge on the path from root to
+    // `To`, where `edge` maps an orientation to an orientation of the same
+    // frames.
+    template <kinematic::frame To, class Edge>
+    [[nodiscard]] constexpr auto from_root(const Edge& edge) const
+        -> orientation<root, To>
+    {
+        static_assert(not kinematic::frame_array<To>,
+                      "a frame family cannot be the source frame");
+        return detail::compose_path<root>(
+            orientation<root, root>{},
+            typename tree::template path_to_t<To>{},
+            [this, &edge]<class O>(std::type_identity<O>) -> decltype(auto) {
+                return edge(get<typename O::source_frame,
+                                typename O::dest_frame>());
+            });
+    }
+
+    template <kinematic::frame To>
+    [[nodiscard]] constexpr auto from_root() const -> orientation<root, To>
+    {
+        return from_root<To>(
+            [](const auto& ori) -> const auto& { return ori; });
+    }
+
+    friend point;
+
+    // Composes the path from root to `To`, also obtaining the motion of the
+    // origin of `To`, for `point` queries
+    template <kinematic::frame To>
+    [[nodiscard]] constexpr auto moving_from_root() const
+        -> detail::moving_frame<root, To>
+    {
+        return detail::compose_path<root>(
+            detail::moving_frame<root, root>{},
+            typename tree::template path_to_t<To>{},
+            [this]<class O>(std::type_identity<O>) {
+                using A = typename O::source_frame;
+                using B = typename O::dest_frame;
+                return detail::moving_frame<A, B>{get<A, B>()};
+            });
+    }
+
+    template <class Path>
+    using penultimate_t =
+        metal::at<Path, metal::number<metal::size<Path>::value - 2>>;
+
+    template <kinematic::frame_array To>
+    using parent_t = penultimate_t<typename tree::template path_to_t<To>>;
+
+    // Composes the path to the parent of family `To` once and then composes the
+    // result with each member of the family.
+    template <kinematic::frame_array To, class Edge>
+    [[nodiscard]] constexpr auto family_from_root(const Edge& edge) const
+        -> std::array<orientation<root, To>, To::size>
+    {
+        return from_root<parent_t<To>>(edge) *
+               edge(get<parent_t<To>, To>());
     }
 
+    struct predictor {
+        scalar dt;
+
+        template <class O>
+        auto operator()(const O& ori) const -> O
+        {
+            return ori.integrated(dt);
+        }
+    };
+
   public:
     /// @brief Expresses the orientation from the world root to a destination
     /// frame
@@ -104,8 +433,8 @@ class world : Os... {
         -> std::enable_if_t<tree::template contains_v<To>,
                             orientation<root, To>>
     {
-        return compose_path(
-            orientation<root, root>{}, typename tree::template path_to_t<To>{});
+        TURTLE_TRACE_SCOPE(world_express);
+        return from_root<To>();
     }
 
     /// @brief Expresses the orientation of one frame relative another
@@ -120,7 +449,200 @@ class world : Os... {
         tree::template contains_v<From> && tree::template contains_v<To>,
         orientation<From, To>>
     {
-        return express<From>().inverse() * express<To>();
+        TURTLE_TRACE_SCOPE(world_express);
+        return from_root<From>().inverse() * from_root<To>();
+    }
+
+    /// @brief Predicts the orientation from the world root to a destination
+    /// frame
+    /// @tparam To Destination frame
+    /// @param dt Prediction horizon
+    ///
+    /// Extrapolates every orientation on the path from world root to frame `To`
+    /// at its stored angular velocity, as if by `integrate(dt)`, and composes
+    /// the results. Only orientations on the path are extrapolated and this
+    /// world is not modified or copied.
+    template <kinematic::frame To>
+    [[nodiscard]] auto predict(scalar dt) const
+        -> std::enable_if_t<tree::template contains_v<To>,
+                            orientation<root, To>>
+    {
+        return from_root<To>(predictor{dt});
+    }
+
+    /// @brief Predicts the orientation of one frame relative another
+    /// @tparam From Source frame
+    /// @tparam To Destination frame
+    /// @param dt Prediction horizon
+    ///
+    /// Extrapolates every orientation on the paths from world root to frames
+    /// `From` and `To` at its stored angular velocity, as if by
+    /// `integrate(dt)`, and composes the results. This world is not modified
+    /// or copied.
+    template <kinematic::frame From, kinematic::frame To>
+    [[nodiscard]] auto predict(scalar dt) const -> std::enable_if_t<
+        // NOLINTNEXTLINE(misc-redundant-expression)
+        tree::template contains_v<From> && tree::template contains_v<To>,
+        orientation<From, To>>
+    {
+        return from_root<From>(predictor{dt}).inverse() *
+               from_root<To>(predictor{dt});
+    }
+
+    /// @brief Expresses the orientation from the world root to every member of
+    /// a frame family
+    /// @tparam To Destination frame family
+    ///
+    /// Composes rotations along the path from world root to the parent of `To`
+    /// once and then composes the result with the orientation of each member.
+    /// Element `i` is the orientation of member `i` relative root.
+    template <kinematic::frame_array To>
+    requires tree::template contains_v<To>
+    [[nodiscard]] constexpr auto express() const
+        -> std::array<orientation<root, To>, To::size>
+    {
+        TURTLE_TRACE_SCOPE(world_express);
+        return family_from_root<To>(
+            [](const auto& ori) -> const auto& { return ori; });
+    }
+
+    /// @brief Expresses the orientation of every member of a frame family
+    /// relative another frame
+    /// @tparam From Source frame
+    /// @tparam To Destination frame family
+    ///
+    /// Composes rotations along the path from frame `From` to world root to
+    /// the parent of `To` once and then composes the result with the
+    /// orientation of each member. Element `i` is the orientation of member
+    /// `i` relative `From`.
+    template <kinematic::frame From, kinematic::frame_array To>
+    requires(tree::template contains_v<From> and tree::template contains_v<To>)
+    [[nodiscard]] constexpr auto express() const
+        -> std::array<orientation<From, To>, To::size>
+    {
+        TURTLE_TRACE_SCOPE(world_express);
+        return (from_root<From>().inverse() * from_root<parent_t<To>>()) *
+               get<parent_t<To>, To>();
+    }
+
+    /// @brief Predicts the orientation from the world root to every member of
+    /// a frame family
+    /// @tparam To Destination frame family
+    /// @param dt Prediction horizon
+    /// @see express, predict
+    template <kinematic::frame_array To>
+    requires tree::template contains_v<To>
+    [[nodiscard]] auto predict(scalar dt) const
+        -> std::array<orientation<root, To>, To::size>
+    {
+        return family_from_root<To>(predictor{dt});
+    }
+
+    /// @brief Predicts the orientation of every member of a frame family
+    /// relative another frame
+    /// @tparam From Source frame
+    /// @tparam To Destination frame family
+    /// @param dt Prediction horizon
+    /// @see express, predict
+    template <kinematic::frame From, kinematic::frame_array To>
+    requires(tree::template contains_v<From> and tree::template contains_v<To>)
+    [[nodiscard]] auto predict(scalar dt) const
+        -> std::array<orientation<From, To>, To::size>
+    {
+        return (from_root<From>(predictor{dt}).inverse() *
+                from_root<parent_t<To>>(predictor{dt})) *
+               get<parent_t<To>, To>().integrated(dt);
+    }
+
+  private:
+    // Composes the orientation of `From` relative to the root with the
+    // orientation of its child `To`, renormalizing as specified by
+    // `renormalization_period`
+    template <class To, class From>
+    [[nodiscard]] auto child(const orientation<root, From>& ori) const
+        -> orientation<root, To>
+    {
+        constexpr auto period = renormalization_period_v<root>;
+        constexpr auto depth =
+            metal::size<typename tree::template path_to_t<To>>::value - 1;
+
+        if constexpr (period != 0 and depth % period == 0) {
+            return renormalized_product(ori, get<From, To>());
+        } else {
+            return ori * get<From, To>();
+        }
+    }
+
+    template <class From, class Fn, class... Nodes>
+    auto propagate(const orientation<root, From>& ori,
+                   Fn& fn,
+                   metal::list<Nodes...>) const -> void
+    {
+        (propagate(ori, fn, Nodes{}), ...);
+    }
+
+    template <class From, class Fn, kinematic::frame To>
+    auto propagate(const orientation<root, From>& ori, Fn& fn, To) const
+        -> void
+    {
+        if constexpr (not kinematic::frame_array<To>) {
+            fn(child<To>(ori));
+        }
+    }
+
+    template <class From, class Fn, class To, class... SubFrames>
+    auto propagate(const orientation<root, From>& ori,
+                   Fn& fn,
+                   meta::tree<To, SubFrames...>) const -> void
+    {
+        const auto composed = child<To>(ori);
+        fn(composed);
+
+        propagate(composed, fn, metal::list<SubFrames...>{});
+    }
+
+  public:
+    /// @brief Invokes a function with the orientation of every frame relative
+    /// to the world root
+    /// @param fn Function invoked with `const orientation<root, F>&` for every
+    /// frame `F` other than the root
+    ///
+    /// Visits the frame tree once in depth-first order, composing each
+    /// orientation with the composed orientation of its parent. This costs one
+    /// composition per frame. Compositions are renormalized as specified by
+    /// `renormalization_period`.
+    ///
+    /// @note Frame families are not visited.
+    template <class Fn>
+    auto for_each_from_root(Fn fn) const -> void
+    {
+        propagate(orientation<root, root>{}, fn, typename tree::branches{});
+    }
+
+    /// @brief Calculates the angular velocity of every frame relative the
+    /// world root
+    /// @tparam E Expression frame
+    /// @return Angular velocity of frame `F` relative root at index
+    /// `index_of<F>()`
+    ///
+    /// Visits the frame tree once, composing each orientation with the
+    /// composed orientation of its parent. This costs one composition per
+    /// frame, in addition to the orientation of `E` relative root.
+    ///
+    /// @note Entries of frame families are not computed and are zero.
+    /// @see express, index_of, for_each_from_root
+    template <kinematic::frame E = root>
+    requires(tree::template contains_v<E> and not kinematic::frame_array<E>)
+    [[nodiscard]] auto angular_velocities() const
+        -> std::array<velocity<root, E>, frame_count>
+    {
+        auto out = std::array<velocity<root, E>, frame_count>{};
+        for_each_from_root(
+            [&out, expr = from_root<E>()]<class F>(
+                const orientation<root, F>& ori) {
+                out[index_of<F>()] = ori.angular_velocity().express_in(expr);
+            });
+        return out;
     }
 };
 
@@ -138,6 +660,15 @@ struct make_tree_impl<meta::tree<Nodes...>, orientation<A, B>, Next...>
     : make_tree_impl<typename meta::tree<Nodes...>::template add_branch_t<A, B>,
                      Next...> {};
 
+template <class Root, class First, class... Next>
+struct make_tree_impl<orientation_array<Root, First>, Next...>
+    : make_tree_impl<meta::tree<Root, First>, Next...> {};
+
+template <class... Nodes, class A, class B, class... Next>
+struct make_tree_impl<meta::tree<Nodes...>, orientation_array<A, B>, Next...>
+    : make_tree_impl<typename meta::tree<Nodes...>::template add_branch_t<A, B>,
+                     Next...> {};
+
 template <class... Nodes>
 struct make_tree_impl<meta::tree<Nodes...>> {
     using type = meta::tree<Nodes...>;
@@ -258,6 +789,8 @@ struct fmt::formatter<W> : fmt::formatter<typename W::scalar> {
     template <class FormatContext>
     auto format(const W& world, FormatContext& ctx)
     {
+        TURTLE_TRACE_SCOPE(format);
+
         auto&& out = ctx.out();
         const auto root = typename W::root{};
 
@@ -0,0 +1,367 @@
+#pragma once
+
+#include "checks.hpp"
+#include "fwd.hpp"
+#include "orientation.hpp"
+#include "point.hpp"
+#include "world.hpp"
+
+#include "metal.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace turtle {
+
+namespace detail {
+
+/// @brief Invokes `fn(first, last)` over contiguous chunks of `[0, n)`
+/// @param n Number of elements
+/// @param threads Maximum number of threads, or 0 to use one per hardware
+/// thread
+/// @param min_chunk Minimum number of elements per thread
+///
+/// The calling thread processes the first chunk. Started threads are always
+/// joined before returning. An exception thrown by `fn` on any thread, or by
+/// starting a thread, is rethrown on the calling thread after the join.
+template <class Fn>
+auto parallel_chunks(std::size_t n,
+                     std::size_t threads,
+                     std::size_t min_chunk,
+                     const Fn& fn) -> void
+{
+    if (threads == 0) {
+        threads = std::max(std::size_t{1},
+                           std::size_t{std::thread::hardware_concurrency()});
+    }
+    threads = std::clamp(n / std::max(min_chunk, std::size_t{1}),
+                         std::size_t{1},
+                         threads);
+
+    const auto chunk = (n + threads - 1) / threads;
+
+    auto errors = std::vector<std::exception_ptr>(threads);
+    auto workers = std::vector<std::thread>{};
+
+    {
+        // joins the started threads on every exit from this scope
+        class joiner {
+            std::vector<std::thread>* workers_;
+
+          public:
+            explicit joiner(std::vector<std::thread>& workers)
+                : workers_{&workers}
+            {}
+            joiner(const joiner&) = delete;
+            joiner(joiner&&) = delete;
+            auto operator=(const joiner&) -> joiner& = delete;
+            auto operator=(joiner&&) -> joiner& = delete;
+            ~joiner()
+            {
+                for (auto& w : *workers_) {
+                    w.join();
+                }
+            }
+        };
+        const auto join = joiner{workers};
+
+        const auto run = [&fn, &errors](auto k, auto first, auto last) {
+            try {
+                fn(first, last);
+            } catch (...) {
+                errors[k] = std::current_exception();
+            }
+        };
+
+        try {
+            workers.reserve(threads - 1);
+            for (auto k = std::size_t{1}; k * chunk < n; ++k) {
+                workers.emplace_back(
+                    run, k, k * chunk, std::min((k + 1) * chunk, n));
+            }
+        } catch (...) {
+            errors.front() = std::current_exception();
+        }
+
+        if (not errors.front()) {
+            run(std::size_t{}, std::size_t{}, std::min(chunk, n));
+        }
+    }
+
+    for (const auto& e : errors) {
+        if (e) {
+            std::rethrow_exception(e);
+        }
+    }
+}
+
+template <class World>
+struct world_orientations;
+
+template <class Tree, class... Os>
+struct world_orientations<world<Tree, Os...>> {
+    using type = std::tuple<std::vector<Os>...>;
+};
+
+}  // namespace detail
+
+/// @brief A collection of worlds of the same type, e.g. for Monte Carlo
+/// analysis
+/// @tparam World Kinematic world type
+///
+/// Stores each orientation of the world in a separate array across all
+/// members, so that a query only reads the orientations on its path. Queries
+/// are evaluated for every member and are split across threads.
+///
+/// Evaluation functions take a maximum number of threads, where 0 selects one
+/// thread per hardware thread. Members are processed in chunks of at least
+/// `min_chunk` per thread.
+template <kinematic::world World>
+class world_ensemble {
+  public:
+    using world_type = World;               ///< Member world type
+    using tree = typename World::tree;      ///< World frame topology
+    using root = typename World::root;      ///< World inertial frame
+    using scalar = typename World::scalar;  ///< World scalar type
+    using point = typename World::point;    ///< World point type
+
+  private:
+    using storage = typename detail::world_orientations<World>::type;
+
+    std::size_t size_{};
+    storage orientations_{};
+
+    template <class O>
+    auto edges() -> std::vector<O>&
+    {
+        return std::get<std::vector<O>>(orientations_);
+    }
+    template <class O>
+    auto edges() const -> const std::vector<O>&
+    {
+        return std::get<std::vector<O>>(orientations_);
+    }
+
+    template <class O>
+    static auto edge(const World& w) -> const O&
+    {
+        return w.template get<typename O::source_frame,
+                              typename O::dest_frame>();
+    }
+
+    template <kinematic::frame To>
+    auto from_root(std::size_t i) const -> orientation<root, To>
+    {
+        return detail::compose_path<root>(
+            orientation<root, root>{},
+            typename tree::template path_to_t<To>{},
+            [this, i]<class O>(std::type_identity<O>) -> const O& {
+                return edges<O>()[i];
+            });
+    }
+
+    template <kinematic::frame To>
+    auto moving_from_root(std::size_t i) const
+        -> detail::moving_frame<root, To>
+    {
+        return detail::compose_path<root>(
+            detail::moving_frame<root, root>{},
+            typename tree::template path_to_t<To>{},
+            [this, i]<class O>(std::type_identity<O>) {
+                using A = typename O::source_frame;
+                using B = typename O::dest_frame;
+                return detail::moving_frame<A, B>{edges<O>()[i]};
+            });
+    }
+
+    // Expresses orientations of a single member, composed directly from the
+    // stored orientations, for `point` queries
+    class member_view {
+        const world_ensemble& ensemble_;
+        std::size_t i_;
+
+      public:
+        member_view(const world_ensemble& ensemble, std::size_t i)
+            : ensemble_{ensemble}, i_{i}
+        {}
+
+        template <class From, class To>
+        [[nodiscard]] auto express() const -> orientation<From, To>
+        {
+            if constexpr (std::is_same_v<From, root>) {
+                return ensemble_.template from_root<To>(i_);
+            } else {
+                return ensemble_.template from_root<From>(i_).inverse() *
+                       ensemble_.template from_root<To>(i_);
+            }
+        }
+
+        template <class To>
+        [[nodiscard]] auto moving_from_root() const
+            -> detail::moving_frame<root, To>
+        {
+            return ensemble_.template moving_from_root<To>(i_);
+        }
+    };
+
+  public:
+    /// @brief Minimum number of members evaluated per thread
+    static constexpr std::size_t min_chunk = 1024;
+
+    /// @brief Constructs an ensemble of copies of a world
+    /// @param size Number of members
+    /// @param nominal World copied to every member
+    explicit world_ensemble(std::size_t size, const World& nominal = {})
+        : size_{size}
+    {
+        std::apply(
+            [size, &nominal]<class... Os>(std::vector<Os>&... vs) {
+                (vs.assign(size, edge<Os>(nominal)), ...);
+            },
+            orientations_);
+    }
+
+    /// @brief Obtains the number of members
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+
+    /// @brief Accesses an orientation of every member
+    /// @tparam From Source frame
+    /// @tparam To Destination frame
+    /// @see world::get
+    template <class From, class To>
+    auto get() noexcept -> std::span<orientation<From, To>>
+    {
+        return edges<orientation<From, To>>();
+    }
+
+    /// @copydoc get
+    template <class From, class To>
+    [[nodiscard]] auto get() const noexcept
+        -> std::span<const orientation<From, To>>
+    {
+        return edges<orientation<From, To>>();
+    }
+
+    /// @brief Obtains a copy of a member
+    /// @param i Member index
+    [[nodiscard]] auto member(std::size_t i) const -> World
+    {
+        return std::apply(
+            [i](const auto&... vs) { return World{vs[i]...}; }, orientations_);
+    }
+
+    /// @brief Replaces a member
+    /// @param i Member index
+    /// @param w World value
+    auto set(std::size_t i, const World& w) -> void
+    {
+        std::apply(
+            [i, &w]<class... Os>(std::vector<Os>&... vs) {
+                ((vs[i] = edge<Os>(w)), ...);
+            },
+            orientations_);
+    }
+
+    /// @brief Expresses the orientation from the world root to a destination
+    /// frame for every member
+    /// @tparam To Destination frame
+    /// @param out Receives the orientation of each member
+    /// @param threads Maximum number of threads
+    /// @pre `out.size() == size()`, checked with the policy of `root`
+    /// @see world::express
+    template <kinematic::frame To>
+    requires tree::template contains_v<To>
+    auto express(std::span<orientation<root, To>> out,
+                 std::size_t threads = 0) const -> void
+    {
+        checks::expect<typename root::check_policy>(out.size() == size());
+
+        detail::parallel_chunks(
+            size(), threads, min_chunk, [this, out](auto first, auto last) {
+                for (auto i = first; i != last; ++i) {
+                    out[i] = from_root<To>(i);
+                }
+            });
+    }
+
+    /// @brief Expresses the orientation of one frame relative another for
+    /// every member
+    /// @tparam From Source frame
+    /// @tparam To Destination frame
+    /// @param out Receives the orientation of each member
+    /// @param threads Maximum number of threads
+    /// @pre `out.size() == size()`, checked with the policy of `From`
+    /// @see world::express
+    template <kinematic::frame From, kinematic::frame To>
+    requires(tree::template contains_v<From> and
+             tree::template contains_v<To>)
+    auto express(std::span<orientation<From, To>> out,
+                 std::size_t threads = 0) const -> void
+    {
+        checks::expect<typename From::check_policy>(out.size() == size());
+
+        detail::parallel_chunks(
+            size(), threads, min_chunk, [this, out](auto first, auto last) {
+                for (auto i = first; i != last; ++i) {
+                    out[i] = from_root<From>(i).inverse() * from_root<To>(i);
+                }
+            });
+    }
+
+    /// @brief Obtains the position of a point in every member
+    /// @tparam F Observation frame
+    /// @param p Point
+    /// @param out Receives the position of `p` in each member
+    /// @param threads Maximum number of threads
+    /// @pre `out.size() == size()`, checked with the policy of `F`
+    /// @see point::position
+    template <kinematic::frame F>
+    requires tree::template contains_v<F>
+    auto position(const point& p,
+                  std::span<turtle::position<F>> out,
+                  std::size_t threads = 0) const -> void
+    {
+        checks::expect<typename F::check_policy>(out.size() == size());
+
+        detail::parallel_chunks(
+            size(), threads, min_chunk, [this, &p, out](auto first, auto last) {
+                for (auto i = first; i != last; ++i) {
+                    out[i] = p.template position_in<F>(member_view{*this, i});
+                }
+            });
+    }
+
+    /// @brief Obtains the velocity of a point in every member
+    /// @tparam A Observation frame
+    /// @tparam F Expression frame
+    /// @param p Point
+    /// @param out Receives the velocity of `p` in each member
+    /// @param threads Maximum number of threads
+    /// @pre `out.size() == size()`, checked with the policy of `A`
+    /// @see point::velocity
+    template <kinematic::frame A, kinematic::frame F = A>
+    requires(tree::template contains_v<A> and tree::template contains_v<F>)
+    auto velocity(const point& p,
+                  std::type_identity_t<std::span<turtle::velocity<A, F>>> out,
+                  std::size_t threads = 0) const -> void
+    {
+        checks::expect<typename A::check_policy>(out.size() == size());
+
+        detail::parallel_chunks(
+            size(), threads, min_chunk, [this, &p, out](auto first, auto last) {
+                for (auto i = first; i != last; ++i) {
+                    out[i] = p.template velocity_in<A, F>(
+                        member_view{*this, i});
+                }
+            });
+    }
+};
+
+}  // namespace turtle
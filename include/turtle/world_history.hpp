@@ -0,0 +1,192 @@
+#pragma once
+
+#include "fwd.hpp"
+#include "orientation.hpp"
+#include "util/seqlock.hpp"
+#include "world.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace turtle {
+
+/// @brief A fixed-capacity buffer of timestamped world snapshots
+/// @tparam World Kinematic world type
+/// @tparam Capacity Number of retained snapshots
+///
+/// Stores the most recent `Capacity` snapshots of a world and answers
+/// orientation queries at arbitrary times, interpolating between the two
+/// snapshots adjacent to the queried time.
+///
+/// Snapshots are added by a single writer thread. Any number of reader threads
+/// may query concurrently. Queries do not allocate and do not block the
+/// writer; a query that overlaps an overwrite of the snapshots it reads is
+/// retried.
+template <kinematic::world World, std::size_t Capacity = 64>
+requires (Capacity != 0)
+class world_history {
+  public:
+    using world_type = World;               ///< Stored world type
+    using root = typename World::root;      ///< World inertial frame
+    using scalar = typename World::scalar;  ///< World scalar type
+
+  private:
+    struct sample {
+        std::uint64_t index;
+        scalar time;
+        World world;
+    };
+
+    // One slot more than the capacity so that the slot being overwritten by an
+    // in-progress push is never one of the `Capacity` readable snapshots.
+    static constexpr std::size_t slots = Capacity + 1;
+
+    std::array<std::atomic<scalar>, slots> times_{};
+    std::array<util::seqlock<sample>, slots> samples_{};
+    std::atomic<std::uint64_t> count_{};
+
+    static constexpr auto slot(std::uint64_t index) noexcept -> std::uint64_t
+    {
+        return index % slots;
+    }
+
+    [[nodiscard]] auto time(std::uint64_t index) const noexcept -> scalar
+    {
+        return times_[slot(index)].load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto load(std::uint64_t index, sample& out) const noexcept
+        -> bool
+    {
+        return samples_[slot(index)].try_load(out) and out.index == index;
+    }
+
+    // Invokes `fn(w0, w1, s)` with the snapshots bracketing time `t` and the
+    // interpolation parameter between them.
+    template <class Fn>
+    [[nodiscard]] auto interpolate(scalar t, Fn fn) const
+        -> std::optional<decltype(fn(World{}, World{}, scalar{}))>
+    {
+        auto s0 = sample{};
+        auto s1 = sample{};
+
+        while (true) {
+            const auto n = count_.load(std::memory_order_acquire);
+            if (n == 0) {
+                return std::nullopt;
+            }
+            const auto first = n - std::min<std::uint64_t>(n, Capacity);
+
+            // index of the first snapshot later than `t`
+            auto next = first;
+            for (auto last = n; next != last;) {
+                const auto mid = next + ((last - next) / 2);
+                if (t < time(mid)) {
+                    last = mid;
+                } else {
+                    next = mid + 1;
+                }
+            }
+
+            const auto i0 = (next == first) ? first : next - 1;
+            const auto i1 = (next == n) ? n - 1 : next;
+
+            if (not load(i0, s0) or not load(i1, s1)) {
+                continue;
+            }
+            if (i0 == i1) {
+                return fn(s0.world, s0.world, scalar{});
+            }
+            if (s0.time <= t and t < s1.time) {
+                return fn(
+                    s0.world, s1.world, (t - s0.time) / (s1.time - s0.time));
+            }
+        }
+    }
+
+  public:
+    /// @brief Constructs an empty history
+    world_history() = default;
+
+    world_history(const world_history&) = delete;
+    world_history(world_history&&) = delete;
+    auto operator=(const world_history&) -> world_history& = delete;
+    auto operator=(world_history&&) -> world_history& = delete;
+    ~world_history() = default;
+
+    /// @brief Adds a snapshot, replacing the oldest if the history is full
+    /// @param t Snapshot time
+    /// @param w World snapshot
+    /// @pre Only called by a single writer thread at a time
+    /// @pre `t` is greater than the time of every previously added snapshot
+    auto push(scalar t, const World& w) noexcept -> void
+    {
+        const auto n = count_.load(std::memory_order_relaxed);
+
+        samples_[slot(n)].store(sample{n, t, w});
+        times_[slot(n)].store(t, std::memory_order_relaxed);
+        count_.store(n + 1, std::memory_order_release);
+    }
+
+    /// @brief Obtains the number of retained snapshots
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(std::min<std::uint64_t>(
+            count_.load(std::memory_order_acquire), Capacity));
+    }
+
+    /// @brief Checks if no snapshot has been added
+    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+    /// @brief Obtains the maximum number of retained snapshots
+    [[nodiscard]] static constexpr auto capacity() noexcept -> std::size_t
+    {
+        return Capacity;
+    }
+
+    /// @brief Expresses the orientation from the world root to a destination
+    /// frame at a given time
+    /// @tparam To Destination frame
+    /// @param t Query time
+    ///
+    /// Interpolates with `slerp` between the snapshots adjacent to `t`. Times
+    /// outside the range of retained snapshots are clamped to the oldest or
+    /// newest snapshot. Returns an empty optional if the history is empty.
+    ///
+    /// The time to find the adjacent snapshots is logarithmic in the number of
+    /// retained snapshots.
+    template <kinematic::frame To>
+    [[nodiscard]] auto express(scalar t) const
+        -> std::optional<orientation<root, To>>
+    {
+        return interpolate(t, [](const World& w0, const World& w1, scalar s) {
+            return slerp(w0.template express<To>(),
+                         w1.template express<To>(),
+                         s);
+        });
+    }
+
+    /// @brief Expresses the orientation of one frame relative another at a
+    /// given time
+    /// @tparam From Source frame
+    /// @tparam To Destination frame
+    /// @param t Query time
+    ///
+    /// @copydetails express(scalar) const
+    template <kinematic::frame From, kinematic::frame To>
+    [[nodiscard]] auto express(scalar t) const
+        -> std::optional<orientation<From, To>>
+    {
+        return interpolate(t, [](const World& w0, const World& w1, scalar s) {
+            return slerp(w0.template express<From, To>(),
+                         w1.template express<From, To>(),
+                         s);
+        });
+    }
+};
+
+}  // namespace turtle
@@ -0,0 +1,173 @@
+#include "turtle/average.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/quaternion.hpp"
+#include "turtle/quaternion_span.hpp"
+#include "turtle/vector_ops.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+using N = turtle::frame<"N">;
+using A = turtle::frame<"A">;
+
+namespace {
+
+auto negated(const turtle::quaternion<double>& q)
+{
+    return turtle::quaternion{-q.w(), -q.x(), -q.y(), -q.z()};
+}
+
+auto dot(const turtle::quaternion<double>& p,
+         const turtle::quaternion<double>& q)
+{
+    return p.w() * q.w() + p.x() * q.x() + p.y() * q.y() + p.z() * q.z();
+}
+
+}  // namespace
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::orientation;
+    using turtle::quaternion;
+    using turtle::quaternion_average;
+    using turtle::test::within;
+
+    const auto center =
+        orientation<N, A>{0.8, normalized(N::vector{1., 2., 2.})};
+
+    // rotations symmetric about `center`
+    const auto samples = [&center] {
+        auto out = std::array<quaternion<double>, 6>{};
+        auto i = std::size_t{};
+        for (const auto& axis : {A::x, A::y, A::z}) {
+            for (const auto angle : {-0.2, 0.2}) {
+                out[i++] =
+                    (center * orientation<A, A>{angle, axis}).rotation();
+            }
+        }
+        return out;
+    }();
+
+    test("average of symmetric samples is the center") = [&] {
+        auto avg = quaternion_average{};
+        for (const auto& q : samples) {
+            avg.add(q);
+        }
+
+        expect(eq(6., avg.weight()));
+        expect(within<1e-15>(center.rotation(), avg.mean()));
+        expect(within<1e-15>(center.rotation(), avg.fast_mean()));
+    };
+
+    test("average does not depend on sample signs") = [&] {
+        auto avg = quaternion_average{};
+        for (auto i = std::size_t{}; i != samples.size(); ++i) {
+            avg.add(i % 2 == 0 ? samples[i] : negated(samples[i]));
+        }
+
+        expect(within<1e-15>(center.rotation(), avg.mean()));
+        expect(within<1e-15>(center.rotation(), avg.fast_mean()));
+    };
+
+    test("average of a single sample is the sample") = [&] {
+        auto avg = quaternion_average{};
+        avg.add(negated(samples[0]), 0.5);
+
+        expect(within<1e-15>(negated(samples[0]), avg.mean()));
+        expect(within<1e-15>(negated(samples[0]), avg.fast_mean()));
+    };
+
+    test("average weights samples") = [] {
+        const auto q1 = orientation<N, A>{0.1, N::z}.rotation();
+        const auto q2 = orientation<N, A>{0.4, N::z}.rotation();
+
+        auto avg = quaternion_average{};
+        avg.add(q1, 2.);
+        avg.add(q2, 1.);
+
+        // close to the weighted average of angles about a common axis
+        const auto expected = orientation<N, A>{0.2, N::z}.rotation();
+        expect(within<1e-3>(expected, avg.mean()));
+        expect(within<1e-3>(expected, avg.fast_mean()));
+    };
+
+    test("mean maximizes the sum of squared dot products") = [] {
+        // widely dispersed samples, where the approximation degrades
+        const auto qs = std::array{orientation<N, A>{}.rotation(),
+                                   orientation<N, A>{2.5, N::x}.rotation(),
+                                   orientation<N, A>{2.5, N::y}.rotation(),
+                                   orientation<N, A>{1.0, N::z}.rotation()};
+
+        auto avg = quaternion_average{};
+        for (const auto& q : qs) {
+            avg.add(q);
+        }
+
+        const auto cost = [&qs](const auto& q) {
+            auto sum = 0.;
+            for (const auto& p : qs) {
+                sum += dot(p, q) * dot(p, q);
+            }
+            return sum;
+        };
+
+        const auto mean = avg.mean();
+        expect(within<1e-15>(1., mean.squared_norm()));
+        expect(gt(cost(mean), cost(avg.fast_mean()) + 1e-3));
+
+        for (const auto& axis : {A::x, A::y, A::z}) {
+            for (const auto angle : {-1e-3, 1e-3}) {
+                const auto nearby =
+                    (orientation<N, A>{mean} * orientation<A, A>{angle, axis})
+                        .rotation();
+                expect(lt(cost(nearby), cost(mean)));
+            }
+        }
+    };
+
+    test("batch average matches streaming average") = [&] {
+        auto w = std::array<double, samples.size()>{};
+        auto x = std::array<double, samples.size()>{};
+        auto y = std::array<double, samples.size()>{};
+        auto z = std::array<double, samples.size()>{};
+        const auto qs = turtle::quaternion_span<double>{w, x, y, z};
+        for (auto i = std::size_t{}; i != samples.size(); ++i) {
+            qs.set(i, samples[i]);
+        }
+
+        auto avg = quaternion_average{};
+        for (const auto& q : samples) {
+            avg.add(q);
+        }
+
+        expect(eq(avg.mean(), mean<double>(qs)));
+        expect(eq(avg.fast_mean(), fast_mean<double>(qs)));
+    };
+
+    test("orientation average includes rates and origins") = [&] {
+        auto oris = std::array<orientation<N, A>, samples.size()>{};
+        for (auto i = std::size_t{}; i != samples.size(); ++i) {
+            const auto k = static_cast<double>(i);
+            oris[i] = orientation<N, A>{samples[i]}
+                          .with(N::velocity{k, 0., 1.})
+                          .with(N::acceleration{0., k, 2.})
+                          .with(N::position{1., 2., k});
+        }
+
+        for (const auto& ori : {mean<N, A>(oris), fast_mean<N, A>(oris)}) {
+            expect(within<1e-15>(center.rotation(), ori.rotation()));
+            expect(within<1e-15>(N::velocity{2.5, 0., 1.},
+                                 ori.angular_velocity()));
+            expect(within<1e-15>(N::acceleration{0., 2.5, 2.},
+                                 ori.angular_acceleration()));
+            expect(within<1e-15>(N::position{1., 2., 2.5}, ori.origin()));
+        }
+    };
+}
@@ -0,0 +1,43 @@
+#include "turtle/checks.hpp"
+
+#include "boost/ut.hpp"
+
+#include <cmath>
+#include <tuple>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    namespace checks = turtle::checks;
+
+    test("none never aborts") = [] {
+        static_assert(not checks::none::enabled);
+
+        checks::expect<checks::none>(false);
+        checks::normalized<checks::none>(2.);
+    };
+
+    test("always aborts on failed check") = [] {
+        static_assert(checks::always::enabled);
+
+        expect(aborts([] { checks::expect<checks::always>(false); }));
+        expect(aborts([] { checks::normalized<checks::always>(2.); }));
+        expect(aborts([] { checks::normalized<checks::always>(2.F); }));
+    };
+
+    test("always accepts squared norm within tolerance") = []<class T>() {
+        checks::expect<checks::always>(true);
+        checks::normalized<checks::always>(T{1});
+        checks::normalized<checks::always>(
+            std::nextafter(T{1}, T{2}) * std::nextafter(T{1}, T{2}));
+    } | std::tuple<float, double>{};
+
+    test("debug follows NDEBUG") = [] {
+#ifdef NDEBUG
+        static_assert(not checks::debug::enabled);
+#else
+        static_assert(checks::debug::enabled);
+        expect(aborts([] { checks::normalized<checks::debug>(2.); }));
+#endif
+    };
+}
@@ -0,0 +1,124 @@
+#include "turtle/dual.hpp"
+
+#include "turtle/checks.hpp"
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/point.hpp"
+#include "turtle/quaternion.hpp"
+#include "turtle/vector_ops.hpp"
+#include "turtle/world.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::orientation;
+    using turtle::world;
+    using turtle::test::within;
+
+    using dual = turtle::dual<double, 3>;
+
+    using N = turtle::frame<"N", dual>;
+    using A = turtle::frame<"A", dual>;
+    using Y = turtle::frame<"Y", dual>;
+    using L = turtle::frame<"L", dual>;
+    using R = turtle::frame<"R", dual>;
+
+    constexpr auto pi = std::numbers::pi;
+
+    test("dual number arithmetic propagates partials") = [] {
+        const auto x = dual::variable(3.0, 0);
+        const auto y = dual::variable(2.0, 1);
+
+        const auto z = (x * y - 2.0 * x) / y + 1.0;
+
+        expect(within<1e-15>(1.0, z.value()));
+        expect(within<1e-15>(0.0, z.partial(0)));
+        expect(within<1e-15>(1.5, z.partial(1)));
+        expect(eq(0.0, z.partial(2)));
+        expect(x > y and x == dual{3.0});
+    };
+
+    test("dual number elementary functions propagate partials") = [] {
+        const auto x = dual::variable(0.3, 0);
+        const auto y = dual::variable(-0.4, 1);
+
+        expect(within<1e-15>(std::cos(0.3), sin(x).partial(0)));
+        expect(within<1e-15>(-std::sin(0.3), cos(x).partial(0)));
+        expect(within<1e-15>(std::exp(0.3), exp(x).partial(0)));
+        expect(within<1e-15>(0.5 / std::sqrt(0.3), sqrt(x).partial(0)));
+        expect(within<1e-15>(-1.0, abs(y).partial(1)));
+
+        const auto a = atan2(y, x);
+        expect(within<1e-15>(std::atan2(-0.4, 0.3), a.value()));
+        expect(within<1e-15>(0.4 / 0.25, a.partial(0)));
+        expect(within<1e-15>(0.3 / 0.25, a.partial(1)));
+
+        const auto h = hypot(x, y, dual{1.2});
+        expect(within<1e-15>(1.3, h.value()));
+        expect(within<1e-15>(0.3 / 1.3, h.partial(0)));
+        expect(within<1e-15>(-0.4 / 1.3, h.partial(1)));
+
+        expect(eq(0.0, sqrt(dual{}).partial(0)));
+        expect(eq(0.0, hypot(dual{}, dual{}, dual{}).partial(0)));
+    };
+
+    test("quaternion operations accept dual numbers") = [] {
+        const auto theta = dual::variable(pi / 3, 0);
+        const auto ori = orientation<N, A>{theta, N::z};
+
+        expect(within<1e-15>(pi / 3, ori.angle().value()));
+        expect(within<1e-15>(1.0, ori.angle().partial(0)));
+        expect(within<1e-15>(0.5 * std::cos(pi / 6),
+                             ori.rotation().z().partial(0)));
+
+        const auto v = norm(N::vector{dual::variable(3.0, 1), 4.0, 0.0});
+        expect(within<1e-15>(5.0, v.value()));
+        expect(within<1e-15>(0.6, v.partial(1)));
+    };
+
+    test("checks accept dual squared norms") = [] {
+        const auto x = dual::variable(1.0, 0);
+
+        expect(eq(1.0, turtle::primal(x)));
+        expect(eq(2.0, turtle::primal(2.0)));
+        turtle::checks::normalized<turtle::checks::always>(x);
+    };
+
+    test("dual scalar world yields partial velocities") = [] {
+        const auto make_world = [](dual u1, dual u2, dual u3) {
+            return world{
+                orientation<N, Y>{0.1, N::z},
+                orientation<Y, L>{0.2, Y::x},
+                orientation<L, R>{0.3, L::y}.with(L::velocity{u1, u2, u3}),
+            };
+        };
+
+        using P = decltype(make_world({}, {}, {}))::point;
+        const auto dmc = P{L::position{0., 0., 1.}, R::velocity{}};
+
+        const auto v = dmc.velocity<N>(make_world(dual::variable(2., 0),
+                                                  dual::variable(3., 1),
+                                                  dual::variable(4., 2)));
+
+        // velocity is linear in the generalized speeds, so each partial
+        // velocity is the velocity with a single unit speed
+        for (auto i = std::size_t{}; i != 3; ++i) {
+            auto u = std::array<dual, 3>{};
+            u[i] = 1.;
+
+            const auto vi = dmc.velocity<N>(make_world(u[0], u[1], u[2]));
+
+            expect(within<1e-15>(vi.x().value(), v.x().partial(i)));
+            expect(within<1e-15>(vi.y().value(), v.y().partial(i)));
+            expect(within<1e-15>(vi.z().value(), v.z().partial(i)));
+        }
+    };
+}
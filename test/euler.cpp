@@ -0,0 +1,146 @@
+#include "turtle/euler.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/quaternion.hpp"
+#include "turtle/quaternion_span.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+using N = turtle::frame<"N">;
+using A = turtle::frame<"A">;
+
+namespace {
+
+using turtle::euler_axes;
+using turtle::euler_sequence;
+
+template <euler_sequence Seq, euler_axes Axes>
+using case_t = std::pair<std::integral_constant<euler_sequence, Seq>,
+                         std::integral_constant<euler_axes, Axes>>;
+
+template <euler_axes Axes>
+using sequences_t = std::tuple<case_t<euler_sequence::xyz, Axes>,
+                               case_t<euler_sequence::xzy, Axes>,
+                               case_t<euler_sequence::yxz, Axes>,
+                               case_t<euler_sequence::yzx, Axes>,
+                               case_t<euler_sequence::zxy, Axes>,
+                               case_t<euler_sequence::zyx, Axes>,
+                               case_t<euler_sequence::xyx, Axes>,
+                               case_t<euler_sequence::xzx, Axes>,
+                               case_t<euler_sequence::yxy, Axes>,
+                               case_t<euler_sequence::yzy, Axes>,
+                               case_t<euler_sequence::zxz, Axes>,
+                               case_t<euler_sequence::zyz, Axes>>;
+
+using all_sequences_t =
+    decltype(std::tuple_cat(sequences_t<euler_axes::body_fixed>{},
+                            sequences_t<euler_axes::space_fixed>{}));
+
+// Composes three elementary rotations
+template <euler_sequence Seq, euler_axes Axes>
+auto composed(const turtle::euler_angles<Seq, Axes>& angles)
+{
+    constexpr auto n = turtle::detail::euler_indices(Seq);
+    const auto axis = std::array{N::x, N::y, N::z};
+
+    const auto q1 = turtle::quaternion{angles.first, axis[n[0]]};
+    const auto q2 = turtle::quaternion{angles.second, axis[n[1]]};
+    const auto q3 = turtle::quaternion{angles.third, axis[n[2]]};
+
+    return Axes == euler_axes::body_fixed ? q1 * q2 * q3 : q3 * q2 * q1;
+}
+
+}  // namespace
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::euler_angles;
+    using turtle::orientation;
+    using turtle::quaternion;
+    using turtle::test::within;
+
+    test("euler angles match composed rotations") = []<class Case>() {
+        using angles_t = euler_angles<Case::first_type::value,
+                                      Case::second_type::value>;
+
+        for (const auto& angles : {angles_t{0.3, -1.2, 2.5},
+                                   angles_t{-2.9, 0.4, 0.1},
+                                   angles_t{}}) {
+            expect(within<1e-15>(composed(angles), angles.rotation()));
+        }
+    } | all_sequences_t{};
+
+    test("euler angle rates map to angular velocity") = []<class Case>() {
+        using angles_t = euler_angles<Case::first_type::value,
+                                      Case::second_type::value>;
+
+        const auto angles = angles_t{0.3, -1.2, 2.5};
+        const auto rates = angles_t{0.7, 1.1, -0.4};
+
+        constexpr auto h = 1e-6;
+        const auto at = [&](double t) {
+            return angles_t{angles.first + t * rates.first,
+                            angles.second + t * rates.second,
+                            angles.third + t * rates.third}
+                .rotation();
+        };
+
+        // ω = 2 q̇ q*, expressed in the initial frame
+        const auto plus = at(h);
+        const auto minus = at(-h);
+        const auto q = angles.rotation();
+        const auto dq = quaternion{(plus.w() - minus.w()) / (2 * h),
+                                   (plus.x() - minus.x()) / (2 * h),
+                                   (plus.y() - minus.y()) / (2 * h),
+                                   (plus.z() - minus.z()) / (2 * h)};
+        const auto w = dq * q.conjugate();
+
+        expect(within<1e-9>(N::velocity{2 * w.x(), 2 * w.y(), 2 * w.z()},
+                            angles.template angular_velocity<N>(rates)));
+    } | all_sequences_t{};
+
+    test("orientation constructible from euler angles") = [] {
+        using yaw_lean_roll = euler_angles<euler_sequence::zxy>;
+
+        const auto angles = yaw_lean_roll{0.4, 0.2, -0.3};
+        const auto rates = yaw_lean_roll{1.0, 0.5, 2.0};
+
+        const auto ori = orientation<N, A>{angles, rates};
+
+        expect(eq(angles.rotation(), ori.rotation()));
+        expect(eq(angles.angular_velocity<N>(rates), ori.angular_velocity()));
+        expect(eq(angles.rotation(), orientation<N, A>{angles}.rotation()));
+    };
+
+    test("batch euler angles match scalar rotation") = [] {
+        using angles_t =
+            euler_angles<euler_sequence::zyz, euler_axes::space_fixed>;
+
+        const auto angles = std::array{angles_t{0.1, 0.2, 0.3},
+                                       angles_t{-1.0, 2.0, 0.5},
+                                       angles_t{3.0, -0.2, 1.5}};
+
+        auto w = std::array<double, 3>{};
+        auto x = std::array<double, 3>{};
+        auto y = std::array<double, 3>{};
+        auto z = std::array<double, 3>{};
+        const auto out = turtle::quaternion_span<double>{w, x, y, z};
+
+        to_quaternion<euler_sequence::zyz, euler_axes::space_fixed, double>(
+            angles, out);
+
+        for (auto i = std::size_t{}; i != angles.size(); ++i) {
+            expect(eq(angles[i].rotation(), out[i]));
+        }
+    };
+}
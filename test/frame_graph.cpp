@@ -0,0 +1,150 @@
+#include "turtle/frame_graph.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/orientation_array.hpp"
+#include "turtle/world.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <cstddef>
+#include <numbers>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::frame_graph;
+    using turtle::orientation;
+    using turtle::orientation_array;
+    using turtle::world;
+    using turtle::test::within;
+
+    using N = turtle::frame<"N">;
+    using A = turtle::frame<"A">;
+    using B = turtle::frame<"B">;
+    using C = turtle::frame<"C">;
+    using Wheel = turtle::frame_array<"Wheel", 2>;
+
+    using graph = frame_graph<>;
+    using node = graph::node;
+    using ori_type = graph::orientation_type;
+
+    constexpr auto pi = std::numbers::pi;
+
+    test("frame graph starts with a root") = [] {
+        const auto g = graph{"N"};
+
+        expect(eq(1UL, g.size()));
+        expect(eq(graph::npos, g.parent(0)));
+        expect(eq(0UL, g.depth(0)));
+        expect(eq(std::string_view{"N"}, g.name(0)));
+        expect(eq(0.0, g.express(0).angle()));
+    };
+
+    test("frame graph adds frames in topological order") = [] {
+        auto g = graph{"N"};
+
+        const auto a = g.add_frame("A", 0, ori_type{pi / 2, node::z});
+        const auto b = g.add_frame("B", a);
+        const auto c = g.add_frame("C", 0);
+
+        expect(eq(1UL, a));
+        expect(eq(2UL, b));
+        expect(eq(3UL, c));
+        expect(eq(a, g.parent(b)));
+        expect(eq(2UL, g.depth(b)));
+        expect(eq(std::optional<std::size_t>{b}, g.find("B")));
+        expect(not g.find("D").has_value());
+        expect(within<1e-15>(pi / 2, g.get(a).angle()));
+    };
+
+    test("frame graph expresses frames") = [] {
+        auto g = graph{"N"};
+
+        const auto a = g.add_frame("A", 0, ori_type{pi / 2, node::z});
+        const auto b = g.add_frame("B", a, ori_type{pi / 3, node::x});
+        const auto c = g.add_frame("C", 0, ori_type{pi / 4, node::y});
+        const auto d = g.add_frame("D", c, ori_type{pi / 5, node::z});
+
+        const auto n_b = g.get(a) * g.get(b);
+        const auto n_d = g.get(c) * g.get(d);
+
+        expect(within<1e-15>(n_b.rotation(), g.express(b).rotation()));
+        expect(within<1e-15>(n_b.rotation(), g.express(0, b).rotation()));
+        expect(within<1e-15>((n_d.inverse() * n_b).rotation(),
+                             g.express(d, b).rotation()));
+        expect(within<1e-15>((n_b.inverse() * n_d).rotation(),
+                             g.express(b, d).rotation()));
+        expect(within<1e-15>(g.get(b).rotation(), g.express(a, b).rotation()));
+        expect(within<1e-15>(g.get(b).inverse().rotation(),
+                             g.express(b, a).rotation()));
+        expect(eq(0.0, g.express(d, d).angle()));
+    };
+
+    test("frame graph expresses all frames") = [] {
+        auto g = graph{"N"};
+
+        const auto a = g.add_frame("A", 0, ori_type{pi / 2, node::z});
+        g.add_frame("B", a, ori_type{pi / 3, node::x});
+        g.add_frame("C", 0, ori_type{pi / 4, node::y});
+
+        auto all = std::vector<ori_type>(g.size());
+        g.express_all(all);
+
+        for (auto i = std::size_t{}; i != g.size(); ++i) {
+            expect(within<1e-15>(g.express(i).rotation(), all[i].rotation()));
+        }
+    };
+
+    test("frame graph integrates all frames") = [] {
+        auto g = graph{"N"};
+
+        const auto a = g.add_frame(
+            "A", 0, ori_type{0.1, node::z}.with(node::velocity{0., 0., 1.}));
+        const auto b = g.add_frame(
+            "B", a, ori_type{0.2, node::x}.with(node::velocity{2., 0., 0.}));
+
+        g.integrate(0.1);
+
+        expect(within<1e-15>(0.2, g.get(a).angle()));
+        expect(within<1e-15>(0.4, g.get(b).angle()));
+    };
+
+    test("frame graph converts from world") = [] {
+        const auto w = world{
+            orientation<N, A>{pi / 2, N::z}.with(N::velocity{0., 0., 1.}),
+            orientation<A, B>{pi / 3, A::x},
+            orientation<N, C>{pi / 4, N::y},
+            orientation_array<C, Wheel>{{
+                orientation<C, Wheel>{0.1, C::y},
+                orientation<C, Wheel>{0.2, C::y},
+            }},
+        };
+
+        const auto g = frame_graph{w};
+        static_assert(std::is_same_v<const graph, decltype(g)>);
+
+        expect(eq(6UL, g.size()));
+        expect(eq(std::string_view{"N"}, g.name(0)));
+
+        const auto a = g.find("A").value();
+        const auto b = g.find("B").value();
+        const auto c = g.find("C").value();
+        const auto w1 = g.find("Wheel[1]").value();
+
+        expect(eq(a, g.parent(b)));
+        expect(eq(c, g.parent(w1)));
+        expect(eq(1.0, g.get(a).angular_velocity().z()));
+
+        expect(within<1e-15>(w.express<B>().rotation(),
+                             g.express(b).rotation()));
+        expect(within<1e-15>(w.express<C, B>().rotation(),
+                             g.express(c, b).rotation()));
+        expect(within<1e-15>(w.express<B, Wheel>()[1].rotation(),
+                             g.express(b, w1).rotation()));
+    };
+}
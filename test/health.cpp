@@ -0,0 +1,173 @@
+#include "turtle/health.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/quaternion.hpp"
+#include "turtle/util/ulp_diff.hpp"
+
+#include "boost/ut.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::norm_monitor;
+    using turtle::norm_stats;
+
+    test("batch ulp_diff matches scalar ulp_diff") = []<class T>() {
+        auto ts = std::vector<T>{};
+        auto t = T{1};
+        for (auto i = 0; i != 100; ++i) {
+            ts.push_back(t);
+            ts.push_back(-t);
+            t = std::nextafter(t, T{2});
+        }
+        ts.push_back(T{});
+        ts.push_back(T{0.5});
+
+        auto out = std::vector<std::size_t>(ts.size());
+        turtle::util::ulp_diff(std::span<const T>{ts}, T{1}, std::span{out});
+
+        for (auto i = std::size_t{}; i != ts.size(); ++i) {
+            expect(eq(turtle::util::ulp_diff(ts[i], T{1}), out[i]));
+        }
+    } | std::tuple<float, double>{};
+
+    test("batch ulp_diff accepts non-finite values") = [] {
+        constexpr auto inf = std::numeric_limits<double>::infinity();
+        const auto ts = std::array{inf, std::nan("")};
+        auto out = std::array<std::size_t, 2>{};
+
+        turtle::util::ulp_diff(std::span<const double>{ts}, 1., std::span{out});
+
+        expect(gt(out[0], std::size_t{1'000'000}));
+        expect(gt(out[1], std::size_t{1'000'000}));
+    };
+
+    test("stats bins ulp differences by power of two") = [] {
+        expect(eq(std::size_t{0}, norm_stats::bin(0)));
+        expect(eq(std::size_t{1}, norm_stats::bin(1)));
+        expect(eq(std::size_t{2}, norm_stats::bin(2)));
+        expect(eq(std::size_t{2}, norm_stats::bin(3)));
+        expect(eq(std::size_t{3}, norm_stats::bin(4)));
+        expect(eq(norm_stats::bins - 1,
+                  norm_stats::bin(std::numeric_limits<std::size_t>::max())));
+    };
+
+    test("monitor counts near violations and violations") = [] {
+        auto m = norm_monitor<double>{4, 2};
+
+        const auto ulps_from_one = [](int n) {
+            auto t = 1.;
+            for (auto i = 0; i != n; ++i) {
+                t = std::nextafter(t, 2.);
+            }
+            return t;
+        };
+
+        auto norms = std::vector<double>{};
+        for (auto i = 0; i != 8; ++i) {
+            norms.push_back(ulps_from_one(i));
+        }
+        m.record_squared_norms(norms);
+
+        const auto s = m.stats();
+        expect(eq(std::uint64_t{8}, s.samples));
+        expect(eq(std::uint64_t{2}, s.near_violations));
+        expect(eq(std::uint64_t{3}, s.violations));
+        expect(eq(std::size_t{7}, s.max_ulp_diff));
+        expect(eq(std::uint64_t{1}, s.distribution[0]));
+        expect(eq(std::uint64_t{4}, s.distribution[3]));
+
+        m.reset();
+        expect(eq(std::uint64_t{}, m.stats().samples));
+    };
+
+    test("monitor records batches of quaternions") = [] {
+        auto m = norm_monitor<float>{};
+
+        const auto qs = std::vector<turtle::quaternion<float>>(
+            200, turtle::quaternion{1.F, 1.F, 0.F, 0.F});
+        m.record(qs);
+
+        const auto s = m.stats();
+        expect(eq(std::uint64_t{200}, s.samples));
+        expect(eq(std::uint64_t{200}, s.violations));
+    };
+
+    test("monitor samples with period") = [] {
+        auto m = norm_monitor<double>{};
+        m.sample_period(10);
+
+        for (auto i = 0; i != 100; ++i) {
+            m.sample(1.);
+        }
+
+        expect(eq(std::uint64_t{10}, m.stats().samples));
+    };
+
+    test("monitors on one thread sample independently") = [] {
+        auto m1 = norm_monitor<double>{};
+        auto m2 = norm_monitor<double>{};
+        m1.sample_period(10);
+        m2.sample_period(3);
+
+        for (auto i = 0; i != 30; ++i) {
+            m1.sample(1.);
+            m2.sample(1.);
+        }
+
+        expect(eq(std::uint64_t{3}, m1.stats().samples));
+        expect(eq(std::uint64_t{10}, m2.stats().samples));
+    };
+
+    test("monitor counts calls per thread") = [] {
+        auto m = norm_monitor<double>{};
+        m.sample_period(10);
+
+        const auto sample = [&m] {
+            for (auto i = 0; i != 100; ++i) {
+                m.sample(1.);
+            }
+        };
+
+        auto t = std::thread{sample};
+        sample();
+        t.join();
+
+        expect(eq(std::uint64_t{20}, m.stats().samples));
+
+        // changing the period restarts the count
+        m.sample(1.);
+        m.sample_period(5);
+        m.sample(1.);
+
+        expect(eq(std::uint64_t{22}, m.stats().samples));
+    };
+
+    test("monitor policy records compositions without aborting") = [] {
+        using N = turtle::frame<"N", double, turtle::checks::monitor>;
+        using A = turtle::frame<"A", double, turtle::checks::monitor>;
+
+        auto& m = norm_monitor<double>::global();
+        m.reset();
+
+        // composition of orientations constructs a new orientation
+        const auto ori = turtle::orientation<N, A>{
+            turtle::quaternion{1., 0., 0., 1.}};
+        const auto ori2 = ori * turtle::orientation<A, A>{};
+
+        expect(eq(2., ori2.rotation().squared_norm()));
+        expect(ge(m.stats().samples, std::uint64_t{2}));
+        expect(ge(m.stats().violations, std::uint64_t{2}));
+    };
+}
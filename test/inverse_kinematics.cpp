@@ -0,0 +1,95 @@
+#include "turtle/inverse_kinematics.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/jacobian.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/point.hpp"
+#include "turtle/vector_ops.hpp"
+#include "turtle/world.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <cstddef>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::ik_options;
+    using turtle::orientation;
+    using turtle::revolute;
+    using turtle::solve_position;
+    using turtle::world;
+    using turtle::test::within;
+
+    using N = turtle::frame<"N">;
+    using A = turtle::frame<"A">;
+    using B = turtle::frame<"B">;
+    using C = turtle::frame<"C">;
+
+    const auto j_a = revolute<N, A>{N::z};
+    const auto j_b = revolute<A, B>{A::y};
+    const auto j_c = revolute<B, C>{B::y};
+
+    // base yaw, shoulder and elbow of an arm with two unit links
+    const auto arm = world{
+        orientation<N, A>{0.1, N::z},
+        orientation<A, B>{-0.3, A::y}.with(A::position{0., 0., 1.}),
+        orientation<B, C>{0.5, B::y}.with(B::position{1., 0., 0.}),
+    };
+
+    using W = decltype(arm);
+    const auto tip = W::point{C::position{1., 0., 0.}, C::velocity{}};
+
+    const auto target = N::position{0.6, 0.8, 1.5};
+
+    test("damped least squares reaches a target") = [=] {
+        auto w = arm;
+        const auto result =
+            solve_position<N>(w, tip, target, ik_options{}, j_a, j_b, j_c);
+
+        expect(result.converged);
+        expect(result.iterations < std::size_t{100});
+        expect(le(result.error, 1e-10));
+        expect(within<1e-9>(target, tip.position<N>(w)));
+    };
+
+    test("gauss-newton reaches a target") = [=] {
+        // undamped steps need a target near the initial position
+        const auto near = N::position{1.2, 0.3, 1.4};
+
+        auto w = arm;
+        const auto result = solve_position<N>(
+            w, tip, near, ik_options{100, 1e-12, 0.}, j_a, j_b, j_c);
+
+        expect(result.converged);
+        expect(result.iterations < std::size_t{10});
+        expect(within<1e-11>(near, tip.position<N>(w)));
+    };
+
+    test("gauss-newton stops at a singular system") = [=] {
+        // two joints cannot move the tip in three directions
+        auto w = arm;
+        const auto result = solve_position<N>(
+            w, tip, target, ik_options{100, 1e-12, 0.}, j_b, j_c);
+
+        expect(not result.converged);
+        expect(eq(std::size_t{1}, result.iterations));
+        expect(eq(arm.get<B, C>().rotation(), w.get<B, C>().rotation()));
+    };
+
+    test("solver stops at the iteration limit") = [=] {
+        // out of reach
+        const auto far = N::position{0., 0., 4.};
+
+        auto w = arm;
+        const auto result =
+            solve_position<N>(w, tip, far, ik_options{5}, j_a, j_b, j_c);
+
+        expect(not result.converged);
+        expect(eq(std::size_t{5}, result.iterations));
+        const auto miss = far - tip.position<N>(w);
+        expect(within<1e-15>(norm(N::vector{miss.x(), miss.y(), miss.z()}),
+                             result.error));
+    };
+}
@@ -0,0 +1,127 @@
+#include "turtle/jacobian.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/point.hpp"
+#include "turtle/world.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <array>
+#include <cstddef>
+#include <numbers>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::jacobian;
+    using turtle::orientation;
+    using turtle::revolute;
+    using turtle::world;
+    using turtle::test::within;
+
+    using N = turtle::frame<"N">;
+    using A = turtle::frame<"A">;
+    using B = turtle::frame<"B">;
+    using C = turtle::frame<"C">;
+    using D = turtle::frame<"D">;
+
+    constexpr auto pi = std::numbers::pi;
+
+    const auto j_a = revolute<N, A>{N::z};
+    const auto j_b = revolute<A, B>{A::y};
+    const auto j_c = revolute<B, C>{B::x};
+    const auto j_d = revolute<N, D>{N::x};
+
+    const auto w = world{
+        orientation<N, A>{pi / 3, N::z}.with(N::position{1., 0., 0.}),
+        orientation<A, B>{pi / 4, A::y}.with(A::position{0., 0., 2.}),
+        orientation<B, C>{}.with(B::position{0.5, 1., 0.}),
+        orientation<N, D>{pi / 6, N::x}.with(N::position{0., 3., 0.}),
+    };
+
+    using W = decltype(w);
+    const auto p = W::point{C::position{1., -1., 0.5}, C::velocity{}};
+
+    test("revolute joint angle") = [j_b, &w] {
+        const auto& ori = w.get<A, B>();
+
+        expect(within<1e-15>(pi / 4, j_b.angle(ori)));
+        expect(
+            within<1e-15>(pi / 4 + 0.1, j_b.angle(j_b.advanced(ori, 0.1))));
+        expect(eq(ori.origin(), j_b.advanced(ori, 0.1).origin()));
+    };
+
+    test("position jacobian matches finite differences") = [=, &w] {
+        const auto jac = jacobian<N>(w, p, j_a, j_b, j_c, j_d);
+
+        constexpr auto h = 1e-6;
+        const auto difference = [&](auto joint, std::size_t i) {
+            using P = typename decltype(joint)::source_frame;
+            using Q = typename decltype(joint)::dest_frame;
+
+            auto plus = w;
+            auto minus = w;
+            plus.template get<P, Q>() = joint.advanced(w.get<P, Q>(), h);
+            minus.template get<P, Q>() = joint.advanced(w.get<P, Q>(), -h);
+
+            const auto expected =
+                (p.position<N>(plus) - p.position<N>(minus)) / (2 * h);
+
+            expect(within<1e-8>(N::vector{expected.x(),
+                                          expected.y(),
+                                          expected.z()},
+                                jac.position[i]));
+        };
+
+        difference(j_a, 0);
+        difference(j_b, 1);
+        difference(j_c, 2);
+        expect(eq(N::vector{}, jac.position[3]));
+    };
+
+    test("jacobian columns are partial velocities") = [=, &w] {
+        constexpr auto rates = std::array{0.3, -1.2, 2.0, 0.7};
+
+        auto moving = w;
+        moving.get<N, A>().with(N::velocity{0., 0., rates[0]});
+        moving.get<A, B>().with(A::velocity{0., rates[1], 0.});
+        moving.get<B, C>().with(B::velocity{rates[2], 0., 0.});
+        moving.get<N, D>().with(N::velocity{rates[3], 0., 0.});
+
+        const auto jac = jacobian<D>(moving, p, j_a, j_b, j_c, j_d);
+
+        auto v = D::vector{};
+        auto omega = D::vector{};
+        for (auto i = std::size_t{}; i != rates.size(); ++i) {
+            v += rates[i] * jac.position[i];
+            omega += rates[i] * jac.orientation[i];
+        }
+
+        const auto expected_v = p.velocity<D>(moving);
+        const auto expected_omega =
+            moving.express<D, C>().angular_velocity();
+
+        expect(within<1e-14>(D::vector{expected_v.x(),
+                                       expected_v.y(),
+                                       expected_v.z()},
+                             v));
+        expect(within<1e-14>(D::vector{expected_omega.x(),
+                                       expected_omega.y(),
+                                       expected_omega.z()},
+                             omega));
+    };
+
+    test("jacobian is defined at zero joint angles") = [j_a] {
+        const auto straight = world{
+            orientation<N, A>{}.with(N::position{1., 0., 0.}),
+        };
+        const auto q = decltype(straight)::point{A::position{2., 0., 0.}};
+
+        const auto jac = jacobian<N>(straight, q, j_a);
+
+        expect(within<1e-15>(N::vector{0., 2., 0.}, jac.position[0]));
+        expect(within<1e-15>(N::vector{0., 0., 1.}, jac.orientation[0]));
+    };
+}
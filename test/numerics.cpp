@@ -0,0 +1,68 @@
+#include "turtle/numerics.hpp"
+
+#include "turtle/checks.hpp"
+#include "turtle/frame.hpp"
+#include "turtle/vector.hpp"
+#include "turtle/vector_ops.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <cmath>
+#include <tuple>
+#include <type_traits>
+
+// selects the fast policy for frames with `float` scalars
+template <>
+struct turtle::numerics::default_policy<float> {
+    using type = turtle::numerics::fast;
+};
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::test::within;
+    namespace checks = turtle::checks;
+    namespace numerics = turtle::numerics;
+
+    using S = turtle::frame<"S">;
+    using F = turtle::frame<"F", double, checks::debug, numerics::fast>;
+
+    test("frames select a numerics policy") = [] {
+        static_assert(std::is_same_v<numerics::safe, S::numerics_policy>);
+        static_assert(std::is_same_v<numerics::fast, F::numerics_policy>);
+
+        using G = turtle::frame<"G", float>;
+        using H = turtle::frame_array<"H", 2, float>;
+        static_assert(std::is_same_v<numerics::fast, G::numerics_policy>);
+        static_assert(std::is_same_v<numerics::fast, H::numerics_policy>);
+    };
+
+    test("policies agree for moderate vectors") = []<class Frame>() {
+        const auto v = typename Frame::vector{3., -4., 12.};
+
+        expect(within<1e-15>(13., norm(v)));
+        expect(within<1e-15>(typename Frame::vector{3., -4., 12.} / 13.,
+                             normalized(v)));
+    } | std::tuple<S, F>{};
+
+    test("policies return the zero vector unchanged") = []<class Frame>() {
+        using V = typename Frame::vector;
+
+        expect(eq(0., norm(V{})));
+        expect(eq(V{}, normalized(V{})));
+    } | std::tuple<S, F>{};
+
+    test("safe policy avoids overflow of squares") = [] {
+        expect(eq(1e200, norm(S::vector{0., 1e200, 0.})));
+        expect(eq(S::z, normalized(S::vector{0., 0., 1e200})));
+
+        expect(std::isinf(norm(F::vector{0., 1e200, 0.})));
+    };
+
+    test("safe policy avoids underflow of squares") = [] {
+        expect(eq(S::x, normalized(S::vector{1e-200, 0., 0.})));
+
+        expect(eq(F::vector{}, normalized(F::vector{1e-200, 0., 0.})));
+    };
+}
@@ -5,7 +5,9 @@
 
 #include "boost/ut.hpp"
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <numbers>
 #include <tuple>
 
@@ -29,6 +31,21 @@ auto main() -> int
         expect(0.0_d == q.z());
     };
 
+    test("orientation quaternion ctor aborts with non-unit quaternion") = [] {
+        expect(aborts([] {
+            turtle::orientation<N, A>{turtle::quaternion{1., 0., 0., 1.}};
+        }));
+    };
+
+    test("orientation quaternion ctor skips check with checks::none") = [] {
+        using B = turtle::frame<"B", double, turtle::checks::none>;
+
+        const auto ori =
+            turtle::orientation<B, A>{turtle::quaternion{1., 0., 0., 1.}};
+
+        expect(eq(1.0_d, ori.rotation().w()));
+    };
+
     test("orientation axis-angle constructible") = [] {
         constexpr auto angle = 0.1;
         constexpr auto axis = N::vector{1., 0., 0.};
@@ -39,6 +56,55 @@ auto main() -> int
         expect(eq(axis, ori.axis()));
     };
 
+    test("orientation axis_angle matches axis and angle") = [] {
+        using O = turtle::orientation<N, A>;
+
+        for (const auto& ori : {O{},
+                                O{1e-9, N::z},
+                                O{2.5, normalized(N::vector{1., -2., 3.})},
+                                O{turtle::quaternion{-1., 0., 0., 0.}}}) {
+            const auto [axis, angle] = ori.axis_angle();
+
+            expect(within<1e-15>(ori.axis(), axis));
+            expect(within<1e-15>(ori.angle(), angle));
+        }
+    };
+
+    test("orientation batch axis_angle matches scalar axis_angle") = [] {
+        const auto oris = std::array{
+            turtle::orientation<N, A>{},
+            turtle::orientation<N, A>{0.3, N::x},
+            turtle::orientation<N, A>{-2., normalized(N::vector{0., 1., 1.})}};
+
+        auto axes = std::array<N::vector, oris.size()>{};
+        auto angles = std::array<double, oris.size()>{};
+        axis_angle<N, A>(oris, axes, angles);
+
+        for (auto i = std::size_t{}; i != oris.size(); ++i) {
+            const auto [axis, angle] = oris[i].axis_angle();
+            expect(eq(axis, axes[i]));
+            expect(eq(angle, angles[i]));
+        }
+
+        auto short_angles = std::array<double, 2>{};
+        expect(aborts([&] { axis_angle<N, A>(oris, axes, short_angles); }));
+    };
+
+    test("orientation batch axis_angle checks with the policy of From") = [] {
+        using U = turtle::frame<"U", double, turtle::checks::none>;
+        using V = turtle::frame<"V", double, turtle::checks::none>;
+
+        const auto oris = std::array{turtle::orientation<U, V>{0.3, U::x}};
+
+        // longer outputs violate the precondition but are written in bounds
+        auto axes = std::array<U::vector, 2>{};
+        auto angles = std::array<double, 2>{};
+        axis_angle<U, V>(oris, axes, angles);
+
+        expect(within<1e-15>(0.3, angles[0]));
+        expect(within<1e-15>(U::x, axes[0]));
+    };
+
     test(
         "orientation axis-angle constructible non-basis axis") = []<class T>() {
         using B = turtle::frame<"B", T>;
@@ -55,6 +121,86 @@ auto main() -> int
         expect(within<tol>(axis, ori.axis()));
     } | std::tuple<float, double>{};
 
+    test("orientation constructible from a direction in both frames") = [] {
+        // gravity in a tilted body frame
+        const auto g_n = N::vector{0., 0., -9.81};
+        const auto g_a = A::vector{1.2, -0.4, -9.7};
+
+        const auto ori = turtle::orientation<N, A>{g_n, g_a};
+
+        expect(within<1e-15>(normalized(g_a), normalized(ori.rotate(g_n))));
+        expect(within<1e-15>(0., dot_product(g_n, ori.axis()) / 9.81));
+    };
+
+    test("orientation renormalized keeps angular velocity") = [] {
+        using B = turtle::frame<"B", double, turtle::checks::none>;
+
+        const auto ori = turtle::orientation<B, A>{
+            turtle::quaternion{1.0001, 0., 0., 0.}}.with(
+            B::velocity{1., 2., 3.});
+
+        const auto r = ori.renormalized();
+
+        expect(within<1e-7>(1., r.rotation().squared_norm()));
+        expect(eq(ori.angular_velocity(), r.angular_velocity()));
+    };
+
+    test("orientation integrates angular velocity") = [] {
+        using B = turtle::frame<"B">;
+        using std::numbers::pi;
+
+        auto ori = turtle::orientation<N, A>{pi / 2., N::x}.with(
+            N::velocity{0., 0., 2.});
+
+        constexpr auto steps = 100;
+        for (auto i = 0; i != steps; ++i) {
+            ori.integrate(0.5 / steps);
+        }
+
+        // angular velocity is expressed in the source frame
+        const auto expected = turtle::orientation<N, B>{1., N::z} *
+                              turtle::orientation<B, A>{pi / 2., B::x};
+
+        const auto& q = ori.rotation();
+        const auto& p = expected.rotation();
+        expect(within<1e-14>(p.w(), q.w()));
+        expect(within<1e-14>(p.x(), q.x()));
+        expect(within<1e-14>(p.y(), q.y()));
+        expect(within<1e-14>(p.z(), q.z()));
+        expect(eq(N::velocity{0., 0., 2.}, ori.angular_velocity()));
+    };
+
+    test("orientation boxplus matches integration") = [] {
+        const auto ori = turtle::orientation<N, A>{0.4, N::y}
+                             .with(N::velocity{0.3, -1., 2.})
+                             .with(N::position{1., 2., 3.});
+
+        const auto stepped = boxplus(ori, 0.5 * N::vector{0.3, -1., 2.});
+
+        expect(within<1e-15>(ori.integrated(0.5).rotation(),
+                             stepped.rotation()));
+        expect(eq(ori.angular_velocity(), stepped.angular_velocity()));
+        expect(eq(ori.origin(), stepped.origin()));
+    };
+
+    test("orientation boxminus inverts boxplus") = [] {
+        const auto ori = turtle::orientation<N, A>{2.5, N::x};
+        const auto delta = N::vector{-0.2, 0.9, 0.1};
+
+        expect(within<1e-15>(delta, boxminus(boxplus(ori, delta), ori)));
+        expect(within<1e-15>(N::vector{}, boxminus(ori, ori)));
+    };
+
+    test("orientation integration keeps unit norm") = [] {
+        auto ori = turtle::orientation<N, A>{}.with(N::velocity{1., -2., 3.});
+
+        for (auto i = 0; i != 100'000; ++i) {
+            ori.integrate(1e-3);
+        }
+
+        expect(within<1e-15>(1., ori.rotation().squared_norm()));
+    };
+
     {
         using B = turtle::frame<"B">;
 
@@ -97,4 +243,94 @@ auto main() -> int
                 within<1e-15>(normalized(N::vector{1., 1., 1.}), ori12.axis()));
         };
     }
+    test("orientation slerp interpolates rotation and angular velocity") = [] {
+        const auto ori1 = turtle::orientation<N, A>{0.2, N::z}.with(
+            N::velocity{0., 0., 1.});
+        const auto ori2 = turtle::orientation<N, A>{0.6, N::z}.with(
+            N::velocity{0., 0., 3.});
+
+        const auto ori = slerp(ori1, ori2, 0.25);
+
+        expect(within<1e-15>(0.3, ori.angle()));
+        expect(within<1e-15>(N::z, ori.axis()));
+        expect(within<1e-15>(N::velocity{0., 0., 1.5}, ori.angular_velocity()));
+    };
+
+    test("orientation integrated leaves source unmodified") = [] {
+        const auto ori =
+            turtle::orientation<N, A>{0.2, N::z}.with(N::velocity{0., 0., 1.});
+
+        const auto next = ori.integrated(0.5);
+
+        expect(within<1e-15>(0.7, next.angle()));
+        expect(within<1e-15>(N::z, next.axis()));
+        expect(within<1e-15>(0.2, ori.angle()));
+    };
+
+    test("orientation nlerp interpolates rotation and angular velocity") = [] {
+        const auto ori1 = turtle::orientation<N, A>{0.2, N::z}.with(
+            N::velocity{0., 0., 1.});
+        const auto ori2 = turtle::orientation<N, A>{0.6, N::z}.with(
+            N::velocity{0., 0., 3.});
+
+        const auto ori = nlerp(ori1, ori2, 0.5);
+
+        expect(within<1e-15>(0.4, ori.angle()));
+        expect(within<1e-15>(N::velocity{0., 0., 2.}, ori.angular_velocity()));
+    };
+
+    test("orientation composes origins") = [] {
+        using B = turtle::frame<"B">;
+
+        const auto ori1 = turtle::orientation<N, A>{std::numbers::pi / 2., N::z}
+                              .with(N::position{1., 0., 0.});
+        const auto ori2 =
+            turtle::orientation<A, B>{}.with(A::position{1., 0., 0.});
+
+        expect(eq(N::position{}, turtle::orientation<N, A>{}.origin()));
+
+        const auto ori12 = ori1 * ori2;
+        expect(within<1e-15>(N::position{1., 1., 0.}, ori12.origin()));
+
+        const auto inv = ori1.inverse();
+        expect(within<1e-15>(A::position{0., 1., 0.}, inv.origin()));
+        expect(within<1e-15>(N::position{}, (ori1 * inv).origin()));
+    };
+
+    test("orientation interpolates origin") = [] {
+        const auto ori1 =
+            turtle::orientation<N, A>{}.with(N::position{0., 0., 1.});
+        const auto ori2 =
+            turtle::orientation<N, A>{}.with(N::position{0., 0., 3.});
+
+        expect(within<1e-15>(N::position{0., 0., 1.5},
+                             slerp(ori1, ori2, 0.25).origin()));
+        expect(within<1e-15>(N::position{0., 0., 2.},
+                             nlerp(ori1, ori2, 0.5).origin()));
+        expect(eq(N::position{0., 0., 1.}, ori1.renormalized().origin()));
+    };
+
+    test("orientation composes angular acceleration") = [] {
+        using B = turtle::frame<"B">;
+
+        const auto ori1 = turtle::orientation<N, A>{}
+                              .with(N::velocity{0., 0., 1.})
+                              .with(N::acceleration{1., 0., 0.});
+        const auto ori2 = turtle::orientation<A, B>{}
+                              .with(A::velocity{2., 0., 0.})
+                              .with(A::acceleration{0., 0., 3.});
+
+        expect(eq(N::acceleration{}, turtle::orientation<N, A>{}
+                                         .angular_acceleration()));
+
+        const auto ori12 = ori1 * ori2;
+        expect(within<1e-15>(N::acceleration{1., 2., 3.},
+                             ori12.angular_acceleration()));
+
+        const auto inv = turtle::orientation<N, A>{std::numbers::pi / 2., N::z}
+                             .with(N::acceleration{1., 0., 0.})
+                             .inverse();
+        expect(within<1e-15>(A::acceleration{0., 1., 0.},
+                             inv.angular_acceleration()));
+    };
 }
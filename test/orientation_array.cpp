@@ -0,0 +1,162 @@
+#include "turtle/orientation_array.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/world.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+#include "fmt/format.h"
+
+#include <array>
+#include <cstddef>
+#include <numbers>
+#include <string>
+#include <type_traits>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::frame;
+    using turtle::frame_array;
+    using turtle::orientation;
+    using turtle::orientation_array;
+    using turtle::world;
+    using turtle::test::within;
+
+    using N = frame<"N">;
+    using A = frame<"A">;
+    using B = frame<"B">;
+    using Wheel = frame_array<"Wheel", 4>;
+
+    constexpr auto pi = std::numbers::pi;
+
+    const auto wheels = orientation_array<A, Wheel>{{
+        orientation<A, Wheel>{0.1, A::y},
+        orientation<A, Wheel>{0.2, A::y},
+        orientation<A, Wheel>{0.3, A::y},
+        orientation<A, Wheel>{0.4, A::y},
+    }};
+
+    test("frame family is a frame") = [] {
+        static_assert(turtle::kinematic::frame<Wheel>);
+        static_assert(turtle::kinematic::frame_array<Wheel>);
+        static_assert(not turtle::kinematic::frame_array<A>);
+        static_assert(Wheel::size == 4);
+
+        expect(eq(std::string{"Wheel[4]"}, fmt::format("{}", Wheel{})));
+    };
+
+    test("orientation array default constructs to identity") = [] {
+        const auto arr = orientation_array<A, Wheel>{};
+
+        static_assert(arr.size() == 4);
+        for (const auto& ori : arr) {
+            expect(eq(0.0, ori.angle()));
+        }
+    };
+
+    test("orientation array composes with parent orientation") = [wheels] {
+        const auto ori = orientation<N, A>{pi / 2, N::z};
+
+        const auto composed = ori * wheels;
+
+        static_assert(std::is_same_v<const std::array<orientation<N, Wheel>, 4>,
+                                     decltype(composed)>);
+        for (auto i = std::size_t{}; i != wheels.size(); ++i) {
+            const auto expected = ori * wheels[i];
+            expect(within<1e-15>(expected.rotation(), composed[i].rotation()));
+        }
+    };
+
+    test("orientation array integrates each member") = [wheels] {
+        auto arr = wheels;
+        for (auto& ori : arr) {
+            ori = ori.with(A::velocity{0., 1., 0.});
+        }
+
+        const auto integrated = arr.integrated(0.5);
+        arr.integrate(0.5);
+
+        for (auto i = std::size_t{}; i != arr.size(); ++i) {
+            expect(within<1e-15>(wheels[i].angle() + 0.5, arr[i].angle()));
+            expect(within<1e-15>(arr[i].angle(), integrated[i].angle()));
+        }
+    };
+
+    test("world deduces tree with frame family") = [wheels] {
+        const auto w = world{
+            orientation<N, A>{},
+            orientation<A, B>{},
+            wheels,
+        };
+
+        using W = std::remove_cvref_t<decltype(w)>;
+        static_assert(W::tree::contains_v<Wheel>);
+        static_assert(std::is_same_v<const orientation_array<A, Wheel>&,
+                                     decltype(w.get<A, Wheel>())>);
+
+        expect(within<1e-15>(0.3, w.get<A, Wheel>()[2].angle()));
+    };
+
+    test("world expresses frame family") = [wheels] {
+        const auto w = world{
+            orientation<N, A>{pi / 2, N::z},
+            orientation<N, B>{pi / 4, N::x},
+            wheels,
+        };
+
+        const auto from_root = w.express<Wheel>();
+        const auto from_b = w.express<B, Wheel>();
+        using W = std::remove_cvref_t<decltype(w)>;
+        const auto velocities = w.angular_velocities();
+        expect(eq(N::velocity{}, velocities[W::index_of<Wheel>()]));
+
+        for (auto i = std::size_t{}; i != Wheel::size; ++i) {
+            const auto expected = w.get<N, A>() * wheels[i];
+            expect(within<1e-15>(expected.rotation(),
+                                 from_root[i].rotation()));
+
+            const auto relative = w.express<B, A>() * wheels[i];
+            expect(within<1e-15>(relative.rotation(), from_b[i].rotation()));
+        }
+    };
+
+    test("world predicts frame family") = [wheels] {
+        auto arr = wheels;
+        for (auto& ori : arr) {
+            ori = ori.with(A::velocity{0., 2., 0.});
+        }
+
+        const auto w = world{
+            orientation<N, A>{0.1, N::z}.with(N::velocity{0., 0., 1.}),
+            orientation<N, B>{}.with(N::velocity{1., 0., 0.}),
+            arr,
+        };
+
+        auto integrated = w;
+        integrated.integrate(0.1);
+
+        const auto predicted = w.predict<Wheel>(0.1);
+        const auto predicted_b = w.predict<B, Wheel>(0.1);
+        const auto expected = integrated.express<Wheel>();
+        const auto expected_b = integrated.express<B, Wheel>();
+
+        for (auto i = std::size_t{}; i != Wheel::size; ++i) {
+            expect(within<1e-15>(expected[i].rotation(),
+                                 predicted[i].rotation()));
+            expect(within<1e-15>(expected_b[i].rotation(),
+                                 predicted_b[i].rotation()));
+            expect(within<1e-15>(wheels[i].angle() + 0.2,
+                                 integrated.get<A, Wheel>()[i].angle()));
+        }
+    };
+
+    test("orientation array formats each member") = [] {
+        const auto arr = orientation_array<A, frame_array<"W", 2>>{};
+
+        expect(eq(std::string{"[W[0]] <- [A] (0, 0, 0), θ: 0\n"
+                              "[W[1]] <- [A] (0, 0, 0), θ: 0"},
+                  fmt::format("{}", arr)));
+    };
+}
@@ -69,4 +69,140 @@ auto main() -> int
         p.position(A::position{1, 0, 1});
         expect(eq(A::position{1, 0, 1}, p.position<A>(w)));
     };
+
+    test("point position relative frame origins") = [] {
+        using B = frame<"B">;
+
+        const auto w = world{
+            orientation<N, A>{pi / 2., N::vector{0., 0., 1.}}.with(
+                N::position{1., 0., 0.}),
+            orientation<A, B>{}.with(A::position{0., 2., 0.}),
+        };
+
+        using Point = decltype(w)::point;
+
+        constexpr auto origin_b = Point{B::position{}};
+
+        expect(within<1e-15>(N::position{-1., 0., 0.},
+                             origin_b.position<N>(w)));
+        expect(within<1e-15>(A::position{0., 2., 0.}, origin_b.position<A>(w)));
+
+        constexpr auto p = Point{N::position{}};
+
+        expect(within<1e-15>(A::position{0., 1., 0.}, p.position<A>(w)));
+        expect(within<1e-15>(B::position{0., -1., 0.}, p.position<B>(w)));
+    };
+
+    test("point velocity relative frame origins") = [] {
+        using B = frame<"B">;
+
+        const auto about_origin = world{
+            orientation<N, B>{}
+                .with(N::position{1., 0., 0.})
+                .with(N::velocity{0., 0., 1.}),
+        };
+
+        constexpr auto origin_b =
+            decltype(about_origin)::point{B::position{}, B::velocity{}};
+
+        expect(eq(N::velocity{}, origin_b.velocity<N>(about_origin)));
+
+        const auto w = world{
+            orientation<N, A>{pi / 2., N::vector{0., 0., 1.}}
+                .with(N::position{1., 0., 0.})
+                .with(N::velocity{0., 0., 2.}),
+            orientation<A, B>{pi / 2., A::vector{1., 0., 0.}}
+                .with(A::position{0., 2., 0.})
+                .with(A::velocity{-1., 0., 0.}),
+        };
+
+        using Point = decltype(w)::point;
+
+        constexpr auto p = Point{B::position{0.5, 0., 1.}, B::velocity{}};
+
+        constexpr auto h = 1e-6;
+        auto plus = w;
+        auto minus = w;
+        plus.integrate(h);
+        minus.integrate(-h);
+
+        const auto dn = (p.position<N>(plus) - p.position<N>(minus)) / (2 * h);
+        const auto da = (p.position<A>(plus) - p.position<A>(minus)) / (2 * h);
+
+        expect(within<1e-8>(N::velocity{dn.x(), dn.y(), dn.z()},
+                            p.velocity<N>(w)));
+        expect(within<1e-8>(A::velocity{da.x(), da.y(), da.z()},
+                            p.velocity<A>(w)));
+
+        const auto moving =
+            Point{B::position{0.5, 0., 1.}, B::velocity{0.3, 0., 0.}};
+        const auto v = B::velocity{0.3, 0., 0.}.express_in<N>(w);
+
+        expect(within<1e-8>(
+            N::velocity{dn.x() + v.x(), dn.y() + v.y(), dn.z() + v.z()},
+            moving.velocity<N>(w)));
+    };
+
+    test("point acceleration in rotating frame") = [] {
+        const auto w = world{orientation<N, A>{}
+                                 .with(N::velocity{0., 0., 2.})
+                                 .with(N::acceleration{0., 0., 3.})};
+
+        using Point = decltype(w)::point;
+
+        constexpr auto fixed = Point{A::position{1., 0., 0.}, A::velocity{}};
+
+        // centripetal and tangential
+        expect(within<1e-15>(turtle::acceleration<N>{-4., 3., 0.},
+                             fixed.acceleration<N>(w)));
+
+        constexpr auto moving =
+            Point{A::position{1., 0., 0.}, A::velocity{1., 0., 0.}};
+
+        // with Coriolis
+        const auto m = moving.motion<N>(w);
+        expect(within<1e-15>(N::position{1., 0., 0.}, m.position));
+        expect(within<1e-15>(moving.velocity<N>(w), m.velocity));
+        expect(within<1e-15>(turtle::acceleration<N>{-4., 7., 0.},
+                             m.acceleration));
+
+        using B = frame<"B">;
+
+        // frames rotate about their own origins
+        const auto offset = world{
+            orientation<N, A>{pi / 2., N::vector{0., 0., 1.}}
+                .with(N::position{1., 0., 0.})
+                .with(N::velocity{0., 0., 2.}),
+            orientation<A, B>{pi / 2., A::vector{1., 0., 0.}}
+                .with(A::position{0., 2., 0.})
+                .with(A::velocity{-1., 0., 0.}),
+        };
+
+        using Offset = decltype(offset)::point;
+
+        constexpr auto origin_a = Offset{A::position{}, A::velocity{}};
+
+        expect(within<1e-15>(turtle::acceleration<N>{},
+                             origin_a.acceleration<N>(offset)));
+
+        constexpr auto p = Offset{B::position{0.5, 0., 1.}, B::velocity{}};
+
+        constexpr auto h = 1e-4;
+        auto plus = offset;
+        auto minus = offset;
+        plus.integrate(h);
+        minus.integrate(-h);
+
+        const auto second_difference = [&]<class F>(F) {
+            const auto d = (p.position<F>(plus) - 2 * p.position<F>(offset) +
+                            p.position<F>(minus)) /
+                           (h * h);
+            return turtle::acceleration<F>{d.x(), d.y(), d.z()};
+        };
+
+        expect(within<1e-6>(second_difference(N{}),
+                            p.acceleration<N>(offset)));
+        expect(within<1e-6>(second_difference(A{}),
+                            p.acceleration<A>(offset)));
+    };
 }
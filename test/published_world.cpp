@@ -0,0 +1,113 @@
+#include "turtle/published_world.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/world.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::frame;
+    using turtle::orientation;
+    using turtle::published_world;
+    using turtle::world;
+    using turtle::test::within;
+
+    using N = frame<"N">;
+    using A = frame<"A">;
+    using B = frame<"B">;
+
+    using W = decltype(world{orientation<N, A>{}, orientation<A, B>{}});
+
+    test("published world default constructible") = [] {
+        const auto shared = published_world<W>{};
+
+        expect(eq(std::uint64_t{1}, shared.version()));
+        expect(eq(0., shared.express<B>().angle()));
+    };
+
+    test("working copy is not visible until published") = [] {
+        auto shared = published_world<W>{};
+
+        shared.working().get<N, A>() = orientation<N, A>{0.5, N::z};
+        expect(eq(0., shared.express<A>().angle()));
+
+        shared.publish();
+        expect(eq(std::uint64_t{2}, shared.version()));
+        expect(within<1e-15>(0.5, shared.express<A>().angle()));
+    };
+
+    test("update modifies and publishes the working copy") = [] {
+        auto shared = published_world<W>{W{
+            orientation<N, A>{0.1, N::x},
+            orientation<A, B>{0.2, A::x},
+        }};
+
+        shared.update([](W& w) {
+            w.get<A, B>() = orientation<A, B>{0.4, A::x};
+        });
+
+        expect(within<1e-15>(0.5, shared.express<N, B>().angle()));
+        expect(within<1e-15>(0.4, shared.snapshot().get<A, B>().angle()));
+    };
+
+    test("try_snapshot copies the published world") = [] {
+        const auto shared = published_world<W>{W{
+            orientation<N, A>{0.3, N::y},
+            orientation<A, B>{},
+        }};
+
+        auto w = W{};
+        expect(shared.try_snapshot(w));
+        expect(within<1e-15>(0.3, w.get<N, A>().angle()));
+    };
+
+    test("readers observe consistent snapshots during publishes") = [] {
+        // both orientations always share an angle, so a torn snapshot
+        // expresses a different angle from N to B
+        auto shared = published_world<W>{};
+
+        constexpr auto publishes = 20'000;
+        constexpr auto readers = 4;
+        auto done = std::atomic<bool>{};
+        auto failures = std::atomic<int>{};
+
+        auto threads = std::vector<std::thread>{};
+        for (auto i = 0; i != readers; ++i) {
+            threads.emplace_back([&shared, &done, &failures] {
+                while (not done.load(std::memory_order_acquire)) {
+                    const auto w = shared.snapshot();
+                    const auto angle = w.get<N, A>().angle();
+                    if (std::abs(2. * angle - w.express<N, B>().angle()) >
+                        1e-12) {
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+
+        for (auto i = 0; i != publishes; ++i) {
+            const auto angle = 1e-4 * (i % 10'000);
+            shared.update([angle](W& w) {
+                w.get<N, A>() = orientation<N, A>{angle, N::z};
+                w.get<A, B>() = orientation<A, B>{angle, A::z};
+            });
+        }
+        done.store(true, std::memory_order_release);
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        expect(eq(0, failures.load()));
+        expect(eq(std::uint64_t{publishes + 1}, shared.version()));
+    };
+}
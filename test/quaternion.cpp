@@ -1,13 +1,18 @@
 #include "turtle/quaternion.hpp"
 
 #include "turtle/frame.hpp"
+#include "turtle/util/ulp_diff.hpp"
 #include "turtle/vector.hpp"
+#include "turtle/vector_ops.hpp"
 #include "test/util/within.hpp"
 
 #include "boost/ut.hpp"
 
 #include <cmath>
 #include <numbers>
+#include <span>
+#include <tuple>
+#include <vector>
 
 using N = turtle::frame<"N">;
 
@@ -57,6 +62,132 @@ auto main() -> int
         expect(aborts([] { turtle::quaternion{0.2, N::vector{1., 0., 1.}}; }));
     };
 
+    test("quaternion angle axis ctor skips check with checks::none") = [] {
+        using A = turtle::frame<"A", double, turtle::checks::none>;
+
+        const auto q = turtle::quaternion{0.2, A::vector{1., 0., 1.}};
+
+        expect(within<1.e-9>(std::sin(0.1), q.x()));
+        expect(within<1.e-9>(std::sin(0.1), q.z()));
+    };
+
+    test("quaternion renormalized reduces norm error") = []<class T>() {
+        const auto q = turtle::quaternion<T>{T{1}, T{2}, T{3}, T{4}};
+        const auto n = std::sqrt(q.squared_norm());
+        const auto eps = T(1e-3);
+
+        const auto p = turtle::quaternion<T>{(T{1} + eps) * q.w() / n,
+                                             (T{1} + eps) * q.x() / n,
+                                             (T{1} + eps) * q.y() / n,
+                                             (T{1} + eps) * q.z() / n};
+        const auto r = p.renormalized();
+
+        expect(lt(std::abs(T{1} - r.squared_norm()), T(1e-5)));
+        expect(within<T(1e-5)>(q.w() / n, r.w()));
+        expect(within<T(1e-5)>(q.z() / n, r.z()));
+    } | std::tuple<float, double>{};
+
+    test("quaternion renormalized keeps unit quaternions") = [] {
+        const auto q = turtle::quaternion{0.2, N::vector{0., 1., 0.}};
+
+        expect(eq(q, q.renormalized()));
+    };
+
+    test("renormalize range of quaternions") = [] {
+        auto qs = std::vector<turtle::quaternion<double>>(
+            100, turtle::quaternion{1.0001, 0., 0., 0.});
+
+        turtle::renormalize(std::span{qs});
+
+        for (const auto& q : qs) {
+            expect(within<1.e-7>(1., q.squared_norm()));
+        }
+    };
+
+    test("quaternion exponential of pure quaternion") = []<class T>() {
+        using A = turtle::frame<"A", T>;
+        const auto axis = normalized(typename A::vector{T{1}, T{2}, T{3}});
+
+        for (auto angle : {T{}, T(1e-6), T(1e-3), T(0.5), T{3}}) {
+            const auto h = angle / T{2};
+            const auto q = turtle::exp(turtle::quaternion<T>{
+                T{}, h * axis.x(), h * axis.y(), h * axis.z()});
+            const auto expected = turtle::quaternion<T>{angle, axis};
+
+            constexpr auto tol = T(std::is_same_v<float, T> ? 1e-6 : 1e-15);
+            expect(within<tol>(expected.w(), q.w()));
+            expect(within<tol>(expected.x(), q.x()));
+            expect(within<tol>(expected.y(), q.y()));
+            expect(within<tol>(expected.z(), q.z()));
+        }
+    } | std::tuple<float, double>{};
+
+    test("quaternion exponential scales by exp of scalar part") = [] {
+        const auto q = turtle::exp(turtle::quaternion{1., 0., 0., 0.});
+
+        expect(within<1.e-15>(std::exp(1.), q.w()));
+        expect(0.0_d == q.x());
+    };
+
+    test("quaternion logarithm inverts exponential") = []<class T>() {
+        using A = turtle::frame<"A", T>;
+        const auto axis = normalized(typename A::vector{T{1}, T{2}, T{3}});
+
+        for (auto angle : {T{}, T(1e-6), T(1e-3), T(0.5), T{3}}) {
+            const auto h = angle / T{2};
+            const auto v = turtle::quaternion<T>{
+                T{}, h * axis.x(), h * axis.y(), h * axis.z()};
+
+            constexpr auto tol = T(std::is_same_v<float, T> ? 1e-6 : 1e-15);
+            expect(within<tol>(v, turtle::log(turtle::exp(v))));
+        }
+    } | std::tuple<float, double>{};
+
+    test("quaternion logarithm of non-unit quaternion") = [] {
+        const auto v = turtle::quaternion{0.5, 0.1, -0.2, 0.3};
+        const auto q = turtle::exp(v);
+
+        const auto r = turtle::log(turtle::quaternion{2., 0., 0., 0.});
+
+        expect(within<1e-15>(v, turtle::log(q)));
+        expect(within<1e-15>(std::log(2.), r.w()));
+        expect(0.0_d == r.x());
+    };
+
+    test("boxplus and boxminus are inverse") = [] {
+        const auto p =
+            turtle::quaternion{0.7, normalized(N::vector{1., 1., 0.})};
+
+        for (const auto& delta : {N::vector{},
+                                  N::vector{1e-9, 0., -2e-9},
+                                  N::vector{0.3, -0.4, 1.2},
+                                  N::vector{0., 3., 0.}}) {
+            const auto q = boxplus(p, delta);
+
+            expect(within<1e-15>(1., q.squared_norm()));
+            expect(within<1e-15>(delta, turtle::boxminus<N::vector>(q, p)));
+        }
+    };
+
+    test("boxplus rotates about fixed axes") = [] {
+        const auto p = turtle::quaternion{0.7, N::x};
+        const auto q = boxplus(p, N::vector{0., 0., 0.4});
+
+        expect(within<1e-15>(turtle::quaternion{0.4, N::z} * p, q));
+    };
+
+    test("boxminus takes the smallest angle") = [] {
+        const auto p = turtle::quaternion{0.2, N::z};
+        const auto q = turtle::quaternion{-0.1, N::z};
+        const auto minus_q =
+            turtle::quaternion{-q.w(), -q.x(), -q.y(), -q.z()};
+
+        expect(within<1e-15>(N::vector{0., 0., -0.3},
+                             turtle::boxminus<N::vector>(q, p)));
+        expect(within<1e-15>(N::vector{0., 0., -0.3},
+                             turtle::boxminus<N::vector>(minus_q, p)));
+    };
+
     test("rotate about x axis") = [] {
         constexpr auto v = N::vector{1., 2., 3.};
         using std::numbers::pi;
@@ -143,4 +274,112 @@ auto main() -> int
             rotate(N::vector{1., 0., 0.}, turtle::quaternion{1., 1., 1., 1.});
         }));
     };
+
+    test("rotate skips check with checks::none") = [] {
+        using A = turtle::frame<"A", double, turtle::checks::none>;
+
+        // non-unit quaternions also scale the rotated vector
+        expect(within<1.e-9>(
+            A::vector{0., 2., 0.},
+            rotate(A::vector{1., 0., 0.}, turtle::quaternion{1., 0., 0., 1.})));
+    };
+    test("quaternion from two vectors rotates one onto the other") = [] {
+        const auto u = N::vector{1., 2., -0.5};
+
+        for (const auto& v : {N::vector{-0.3, 4., 1.},
+                              2. * u,
+                              -3. * u,
+                              N::vector{0., 0., -1.}}) {
+            const auto q = turtle::quaternion{u, v};
+
+            expect(le(turtle::util::ulp_diff(1., q.squared_norm()), 4U));
+            expect(within<1e-15>(normalized(v), normalized(rotate(u, q))));
+        }
+    };
+
+    test("quaternion from two opposite vectors rotates by pi") = [] {
+        for (const auto& u : {N::vector{0., 0., 2.}, N::vector{-3., 1., 0.}}) {
+            const auto q = turtle::quaternion{u, -u};
+
+            expect(eq(0., q.w()));
+            expect(within<1e-15>(-u, rotate(u, q)));
+        }
+    };
+
+    test("quaternion from two vectors aborts with zero vector") = [] {
+        expect(aborts([] {
+            std::ignore = turtle::quaternion{N::vector{}, N::x};
+        }));
+    };
+
+    test("slerp interpolates at constant angular rate") = [] {
+        using std::numbers::pi;
+        constexpr auto axis = N::vector{0., 0., 1.};
+
+        const auto q = turtle::quaternion{0., axis};
+        const auto p = turtle::quaternion{pi / 2., axis};
+
+        expect(within<1e-15>(q, slerp(q, p, 0.)));
+        expect(within<1e-15>(p, slerp(q, p, 1.)));
+        expect(within<1e-15>(turtle::quaternion{pi / 8., axis},
+                             slerp(q, p, 0.25)));
+        expect(within<1e-15>(1., slerp(q, p, 0.7).squared_norm()));
+    };
+
+    test("slerp takes the shorter arc") = [] {
+        using std::numbers::pi;
+        constexpr auto axis = N::vector{1., 0., 0.};
+
+        const auto q = turtle::quaternion{0., axis};
+        const auto p = turtle::quaternion{pi / 2., axis};
+        const auto neg_p = turtle::quaternion{-p.w(), -p.x(), -p.y(), -p.z()};
+
+        expect(within<1e-15>(turtle::quaternion{pi / 4., axis},
+                             slerp(q, neg_p, 0.5)));
+    };
+
+    test("slerp handles nearly equal quaternions") = [] {
+        constexpr auto axis = N::vector{0., 1., 0.};
+
+        const auto q = turtle::quaternion{1., axis};
+        const auto p = turtle::quaternion{1. + 1e-12, axis};
+
+        expect(within<1e-15>(turtle::quaternion{1. + 0.5e-12, axis},
+                             slerp(q, p, 0.5)));
+    };
+
+    test("nlerp follows the slerp path") = [] {
+        using std::numbers::pi;
+        constexpr auto axis = N::vector{0., 1., 0.};
+
+        const auto q = turtle::quaternion{0.2, axis};
+        const auto p = turtle::quaternion{1.4, axis};
+        const auto neg_p = turtle::quaternion{-p.w(), -p.x(), -p.y(), -p.z()};
+
+        expect(within<1e-15>(q, nlerp(q, p, 0.)));
+        expect(within<1e-15>(p, nlerp(q, p, 1.)));
+        expect(within<1e-15>(slerp(q, p, 0.5), nlerp(q, p, 0.5)));
+        expect(within<1e-15>(slerp(q, p, 0.5), nlerp(q, neg_p, 0.5)));
+        expect(within<1e-15>(1., nlerp(q, p, 0.3).squared_norm()));
+    };
+
+    test("fast_slerp approximates slerp") = [] {
+        using std::numbers::pi;
+        constexpr auto axis = N::vector{0., 0., 1.};
+        const auto q = turtle::quaternion{0., axis};
+
+        const auto angle = [](const auto& r) {
+            return 2. * std::atan2(r.z(), r.w());
+        };
+
+        for (auto a = 0.01; a < pi; a += 0.01) {
+            const auto p = turtle::quaternion{a, axis};
+            for (auto t = 0.; t <= 1.; t += 0.05) {
+                const auto tol = a < 1. ? 2e-5 : 1e-3;
+                expect(le(std::abs(angle(slerp(q, p, t)) -
+                                   angle(fast_slerp(q, p, t))),
+                          tol));
+            }
+        }
+    };
 }
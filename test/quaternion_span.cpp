@@ -0,0 +1,135 @@
+#include "turtle/quaternion_span.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/quaternion.hpp"
+#include "turtle/vector.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <array>
+#include <cstddef>
+
+using N = turtle::frame<"N">;
+
+constexpr auto n = std::size_t{5};
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::quaternion;
+    using turtle::quaternion_span;
+    using turtle::test::within;
+
+    struct soa {
+        std::array<double, n> w{};
+        std::array<double, n> x{};
+        std::array<double, n> y{};
+        std::array<double, n> z{};
+
+        auto view() -> quaternion_span<double> { return {w, x, y, z}; }
+    };
+
+    auto q = soa{};
+    auto p = soa{};
+    auto t = std::array<double, n>{};
+    for (auto i = std::size_t{}; i != n; ++i) {
+        const auto k = static_cast<double>(i);
+        q.view().set(i, quaternion{0.1 * k, N::vector{1., 0., 0.}});
+        p.view().set(
+            i, quaternion{0.3 * k, normalized(N::vector{0., 1., k})});
+        t[i] = 0.2 * k;
+    }
+
+    test("span accesses quaternions by index") = [&q] {
+        const quaternion_span<const double> qs = q.view();
+
+        expect(eq(n, qs.size()));
+        expect(qs.consistent());
+        expect(within<1e-15>(quaternion{0.2, N::vector{1., 0., 0.}}, qs[2]));
+    };
+
+    test("batch slerp matches scalar slerp") = [&] {
+        auto out = soa{};
+        slerp(q.view(), p.view(), t, out.view());
+
+        for (auto i = std::size_t{}; i != n; ++i) {
+            expect(within<1e-15>(slerp(q.view()[i], p.view()[i], t[i]),
+                                 out.view()[i]));
+        }
+    };
+
+    test("batch nlerp matches scalar nlerp") = [&] {
+        auto out = soa{};
+        nlerp(q.view(), p.view(), t, out.view());
+
+        for (auto i = std::size_t{}; i != n; ++i) {
+            expect(within<1e-15>(nlerp(q.view()[i], p.view()[i], t[i]),
+                                 out.view()[i]));
+        }
+    };
+
+    test("batch fast_slerp matches scalar fast_slerp") = [&] {
+        auto out = soa{};
+        fast_slerp(q.view(), p.view(), t, out.view());
+
+        for (auto i = std::size_t{}; i != n; ++i) {
+            expect(within<1e-15>(fast_slerp(q.view()[i], p.view()[i], t[i]),
+                                 out.view()[i]));
+        }
+    };
+
+    test("batch shortest_arc matches scalar constructor") = [] {
+        auto u = std::array<N::vector, n>{};
+        auto v = std::array<N::vector, n>{};
+        for (auto i = std::size_t{}; i != n; ++i) {
+            const auto k = static_cast<double>(i);
+            u[i] = N::vector{1., k, 0.};
+            v[i] = N::vector{-k, 0., 1.};
+        }
+
+        auto out = soa{};
+        shortest_arc<N::vector>(u, v, out.view());
+
+        for (auto i = std::size_t{}; i != n; ++i) {
+            expect(eq(quaternion{u[i], v[i]}, out.view()[i]));
+        }
+    };
+
+    test("batch exp and log match scalar exp and log") = [&] {
+        auto logs = soa{};
+        log<double>(q.view(), logs.view());
+
+        auto exps = soa{};
+        exp<double>(logs.view(), exps.view());
+
+        for (auto i = std::size_t{}; i != n; ++i) {
+            expect(eq(log(q.view()[i]), logs.view()[i]));
+            expect(eq(exp(logs.view()[i]), exps.view()[i]));
+            expect(within<1e-15>(q.view()[i], exps.view()[i]));
+        }
+    };
+
+    test("batch boxplus and boxminus match scalar operations") = [&] {
+        auto delta = std::array<N::vector, n>{};
+        boxminus<N::vector>(p.view(), q.view(), delta);
+
+        auto out = soa{};
+        boxplus<N::vector>(q.view(), delta, out.view());
+
+        for (auto i = std::size_t{}; i != n; ++i) {
+            expect(eq(boxminus<N::vector>(p.view()[i], q.view()[i]), delta[i]));
+            expect(eq(boxplus(q.view()[i], delta[i]), out.view()[i]));
+            expect(within<1e-15>(p.view()[i], out.view()[i]));
+        }
+    };
+
+    test("batch interpolation aborts with mismatched sizes") = [&] {
+        expect(aborts([&] {
+            auto out = soa{};
+            auto v = out.view();
+            v.z = v.z.first(n - 1);
+            slerp(q.view(), p.view(), t, v);
+        }));
+    };
+}
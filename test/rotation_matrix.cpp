@@ -0,0 +1,187 @@
+#include "turtle/rotation_matrix.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/quaternion.hpp"
+#include "turtle/quaternion_span.hpp"
+#include "turtle/vector_ops.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+
+using N = turtle::frame<"N">;
+using A = turtle::frame<"A">;
+using B = turtle::frame<"B">;
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::orientation;
+    using turtle::rotation_matrix;
+    using turtle::test::within;
+
+    constexpr auto pi = std::numbers::pi;
+
+    const auto ori = orientation<N, A>{0.7, normalized(N::vector{1., -2., 3.})};
+    const auto v = N::vector{0.3, -1.1, 2.5};
+
+    test("rotation matrix default constructible") = [v] {
+        constexpr auto m = rotation_matrix<N, A>{};
+
+        expect(eq(1., m(0, 0)) and eq(1., m(1, 1)) and eq(1., m(2, 2)));
+        expect(eq(A::vector{v.x(), v.y(), v.z()}, m.rotate(v)));
+    };
+
+    test("rotation matrix rotates like orientation") = [ori, v] {
+        const auto m = rotation_matrix<N, A>{ori.rotation()};
+
+        expect(within<1e-15>(ori.rotate(v), m.rotate(v)));
+        expect(within<1e-15>(ori.rotate(N::x), A::vector{m(0, 0),
+                                                         m(1, 0),
+                                                         m(2, 0)}));
+    };
+
+    test("rotation matrix applies to kinematic vectors") = [ori, v] {
+        const auto m = rotation_matrix<N, A>{ori.rotation()};
+        const auto u = ori.rotate(v);
+
+        const auto r = m.rotate(N::position{v.x(), v.y(), v.z()});
+        expect(within<1e-15>(A::position{u.x(), u.y(), u.z()}, r));
+
+        const auto w = m.rotate(N::velocity{v.x(), v.y(), v.z()});
+        expect(within<1e-15>(turtle::velocity<N, A>{u.x(), u.y(), u.z()}, w));
+
+        const auto a = m.rotate(N::acceleration{v.x(), v.y(), v.z()});
+        expect(within<1e-15>(turtle::acceleration<N, A>{u.x(), u.y(), u.z()},
+                             a));
+    };
+
+    test("rotation matrix rotates ranges") = [ori] {
+        const auto m = rotation_matrix<N, A>{ori.rotation()};
+
+        const auto in = std::array{N::x, N::y, N::z};
+        auto out = std::array<A::vector, 3>{};
+        m.rotate(std::span{in}, std::span{out});
+
+        for (auto i = std::size_t{}; i != in.size(); ++i) {
+            expect(within<1e-15>(ori.rotate(in[i]), out[i]));
+        }
+
+        auto short_out = std::array<A::vector, 2>{};
+        expect(aborts([&] { m.rotate(std::span{in}, std::span{short_out}); }));
+    };
+
+    test("rotation matrix converts to quaternion") = [] {
+        // rotations selecting each branch of Shepperd's method
+        for (const auto& q : {orientation<N, A>{0.3, N::z}.rotation(),
+                              orientation<N, A>{3.0, N::x}.rotation(),
+                              orientation<N, A>{3.0, N::y}.rotation(),
+                              orientation<N, A>{3.0, N::z}.rotation(),
+                              orientation<N, A>{
+                                  pi, normalized(N::vector{1., 1., 0.})}
+                                  .rotation()}) {
+            const auto p = rotation_matrix<N, A>{q}.rotation();
+
+            // q and -q represent the same rotation
+            const auto dot =
+                p.w() * q.w() + p.x() * q.x() + p.y() * q.y() + p.z() * q.z();
+            const auto s = dot < 0. ? -1. : 1.;
+
+            const auto r =
+                turtle::quaternion{s * p.w(), s * p.x(), s * p.y(), s * p.z()};
+            expect(within<1e-15>(q, r));
+        }
+    };
+
+    test("rotation matrix converts to unit quaternion if not orthonormal") =
+        [ori, v] {
+            using rows_type = rotation_matrix<N, A>::rows_type;
+
+            constexpr auto scale = 1. + 1e-9;
+            constexpr auto eps = std::numeric_limits<double>::epsilon();
+
+            for (const auto& q : {orientation<N, A>{}.rotation(),
+                                  orientation<N, A>{3.0, N::x}.rotation(),
+                                  orientation<N, A>{3.0, N::y}.rotation(),
+                                  orientation<N, A>{3.0, N::z}.rotation(),
+                                  ori.rotation()}) {
+                const auto m = rotation_matrix<N, A>{q};
+
+                auto rows = rows_type{};
+                for (auto i = std::size_t{}; i != rows.size(); ++i) {
+                    for (auto j = std::size_t{}; j != rows[i].size(); ++j) {
+                        rows[i][j] = scale * m(i, j);
+                    }
+                }
+                const auto scaled = rotation_matrix<N, A>{rows};
+
+                expect(le(std::abs(1. - scaled.rotation().squared_norm()),
+                          4. * eps));
+
+                // constructing and composing check the unit norm
+                const auto o = orientation<N, A>{scaled};
+                expect(within<1e-8>(ori.inverse().rotate(m.rotate(v)),
+                                    (o * ori.inverse()).rotate(v)));
+            }
+        };
+
+    test("rotation matrix converts batches to quaternions") = [ori] {
+        const auto m = std::array{rotation_matrix<N, A>{},
+                                  rotation_matrix<N, A>{ori.rotation()},
+                                  ori.matrix() * ori.matrix().inverse() *
+                                      rotation_matrix{ori}};
+
+        auto w = std::array<double, 3>{};
+        auto x = std::array<double, 3>{};
+        auto y = std::array<double, 3>{};
+        auto z = std::array<double, 3>{};
+        const auto out = turtle::quaternion_span<double>{w, x, y, z};
+        to_quaternion<N, A>(m, out);
+
+        for (auto i = std::size_t{}; i != m.size(); ++i) {
+            expect(eq(m[i].rotation(), out[i]));
+        }
+    };
+
+    test("orientation constructible from rotation matrix") = [ori, v] {
+        const auto m = rotation_matrix<N, A>{ori.rotation()};
+        const auto o = orientation<N, A>{m};
+
+        expect(within<1e-15>(o.rotation(), ori.rotation()));
+        expect(within<1e-15>(ori.rotate(v), o.rotate(v)));
+        expect(within<1e-15>(ori.angle(), o.angle()));
+    };
+
+    test("rotation matrix composes like orientation") = [ori, v] {
+        const auto ori2 = orientation<A, B>{-1.2, A::y};
+
+        const auto m = rotation_matrix<N, A>{ori.rotation()} *
+                       rotation_matrix<A, B>{ori2.rotation()};
+
+        expect(within<1e-15>((ori * ori2).rotate(v), m.rotate(v)));
+        expect(within<1e-15>(v, m.inverse().rotate(m.rotate(v))));
+    };
+
+    test("orientation forms its rotation matrix") = [ori, v] {
+        const auto m = ori.matrix();
+        expect(eq(rotation_matrix{ori}, m));
+        expect(within<1e-15>(ori.rotate(v), m.rotate(v)));
+
+        auto o = ori;
+        o.with(N::velocity{0., 0., 1.}).integrate(0.5);
+        expect(within<1e-15>(o.rotation(), o.matrix().rotation()));
+
+        const auto in = std::array{v, N::x};
+        auto out = std::array<A::vector, 2>{};
+        o.rotate(std::span{in}, std::span{out});
+        expect(eq(o.matrix().rotate(v), out[0]));
+        expect(within<1e-15>(o.rotate(v), out[0]));
+    };
+}
@@ -0,0 +1,133 @@
+#include "turtle/util/trace.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/point.hpp"
+#include "turtle/world.hpp"
+
+#include "fmt/format.h"
+
+#include "boost/ut.hpp"
+
+#include <cstdint>
+#include <numbers>
+#include <thread>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using std::numbers::pi;
+    using turtle::frame;
+    using turtle::orientation;
+    using turtle::world;
+
+    namespace trace = turtle::util::trace;
+    using trace::buckets;
+    using trace::probe;
+
+    using N = frame<"N">;
+    using A = frame<"A">;
+    using B = frame<"B">;
+
+    static_assert(trace::enabled);
+
+    test("small values have exact buckets") = [] {
+        for (auto v = std::uint64_t{}; v != buckets::sub_bucket_count; ++v) {
+            expect(eq(v, buckets::lower_bound(buckets::index(v))));
+        }
+    };
+
+    test("bucket lower bound is within relative error") = [] {
+        for (auto v = std::uint64_t{1}; v < (std::uint64_t{1} << 40U);
+             v = (v * 3) / 2 + 1) {
+            const auto lo = buckets::lower_bound(buckets::index(v));
+            expect(le(lo, v));
+            expect(lt(v - lo, (v >> buckets::sub_bucket_bits) + 1));
+        }
+    };
+
+    test("buckets are ordered") = [] {
+        for (auto i = std::size_t{1}; i != buckets::count; ++i) {
+            expect(lt(buckets::lower_bound(i - 1), buckets::lower_bound(i)));
+        }
+        expect(eq(buckets::count - 1, buckets::index(~std::uint64_t{})));
+    };
+
+    test("snapshot percentiles") = [] {
+        auto h = trace::histogram{};
+        for (auto v = std::uint64_t{1}; v <= 100; ++v) {
+            h.record(v);
+        }
+
+        auto s = trace::histogram_snapshot{};
+        expect(eq(std::uint64_t{}, s.value_at(0.5)));
+
+        s.merge(h);
+        expect(eq(std::uint64_t{100}, s.total()));
+        expect(eq(std::uint64_t{1}, s.value_at(0.)));
+        expect(le(s.value_at(0.5), std::uint64_t{50}));
+        expect(ge(s.value_at(0.5), std::uint64_t{48}));
+        expect(le(s.value_at(0.99), std::uint64_t{99}));
+        expect(ge(s.value_at(0.99), std::uint64_t{96}));
+    };
+
+    const auto w = world{
+        orientation<N, A>{pi / 2., N::z},
+        orientation<A, B>{pi / 3., A::x},
+    };
+    using P = decltype(w)::point;
+
+    test("world express is traced once per call") = [&w] {
+        trace::reset();
+
+        static_cast<void>(w.express<B>());
+        static_cast<void>(w.express<A, B>());
+
+        expect(eq(std::uint64_t{2},
+                  trace::snapshot(probe::world_express).total()));
+    };
+
+    test("point queries are traced") = [&w] {
+        trace::reset();
+
+        const auto p = P{B::position{1, 0, 0}, A::velocity{}};
+        static_cast<void>(p.position<N>(w));
+        static_cast<void>(p.velocity<N>(w));
+
+        expect(eq(std::uint64_t{1},
+                  trace::snapshot(probe::point_velocity).total()));
+        expect(ge(trace::snapshot(probe::point_position).total(),
+                  std::uint64_t{2}));
+    };
+
+    test("formatting is traced") = [&w] {
+        trace::reset();
+
+        static_cast<void>(fmt::format("{}", w));
+
+        expect(eq(std::uint64_t{1}, trace::snapshot(probe::format).total()));
+    };
+
+    test("samples from all threads are merged") = [&w] {
+        trace::reset();
+
+        constexpr auto calls = 100;
+        const auto query = [&w] {
+            for (auto i = 0; i != calls; ++i) {
+                static_cast<void>(w.express<N, B>());
+            }
+        };
+
+        auto t1 = std::thread{query};
+        auto t2 = std::thread{query};
+        t1.join();
+        t2.join();
+
+        auto count = std::uint64_t{};
+        trace::dump([&count](probe p, const trace::histogram_snapshot& s) {
+            if (p == probe::world_express) {
+                count = s.total();
+            }
+        });
+        expect(eq(std::uint64_t{2 * calls}, count));
+    };
+}
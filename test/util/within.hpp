@@ -54,6 +54,19 @@ auto within(const V& v, const V& u)
            boost::ut::eq(ut_value{v.y(), Tol}, u.y()) and
            boost::ut::eq(ut_value{v.z(), Tol}, u.z());
 }
+
+template <AUTO Tol, class T>
+requires std::same_as <tolerance_type_t<decltype(Tol)>, T>
+auto within(const turtle::quaternion<T>& q, const turtle::quaternion<T>& p)
+{
+    using boost::ut::operator and;
+    using ut_value = boost::ut::detail::value<T>;
+
+    return boost::ut::eq(ut_value{q.w(), Tol}, p.w()) and
+           boost::ut::eq(ut_value{q.x(), Tol}, p.x()) and
+           boost::ut::eq(ut_value{q.y(), Tol}, p.y()) and
+           boost::ut::eq(ut_value{q.z(), Tol}, p.z());
+}
 // clang-format on
 
 }  // namespace turtle::test
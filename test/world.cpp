@@ -3,11 +3,62 @@
 #include "turtle/frame.hpp"
 #include "turtle/meta.hpp"
 #include "turtle/orientation.hpp"
+#include "turtle/util/perfect_hash.hpp"
 #include "test/util/within.hpp"
 
 #include "boost/ut.hpp"
 
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <numbers>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+template <turtle::detail::descriptor Name>
+using unchecked_frame = turtle::frame<Name, double, turtle::checks::none>;
+
+using Drifting = unchecked_frame<"Drifting">;
+using Renormalized = unchecked_frame<"Renormalized">;
+
+template <char Prefix, std::size_t I>
+constexpr char link_name[] = {Prefix,
+                               static_cast<char>('0' + I / 10),
+                               static_cast<char>('0' + I % 10),
+                               '\0'};
+
+template <std::size_t I>
+using chain =
+    turtle::frame<link_name<'L', I>, double, turtle::checks::always>;
+
+template <std::size_t I>
+using sweep =
+    turtle::frame<link_name<'S', I>, double, turtle::checks::always>;
+
+template <std::size_t I>
+constexpr char letter_name[] = {static_cast<char>('A' + I / 26),
+                                 static_cast<char>('A' + I % 26),
+                                 '\0'};
+
+template <std::size_t I>
+using letters = turtle::frame<letter_name<I>>;
+
+}  // namespace
+
+template <>
+struct turtle::renormalization_period<Renormalized>
+    : std::integral_constant<std::size_t, 1> {};
+
+template <>
+struct turtle::renormalization_period<chain<0>>
+    : std::integral_constant<std::size_t, 8> {};
+
+template <>
+struct turtle::renormalization_period<sweep<0>>
+    : std::integral_constant<std::size_t, 4> {};
 
 auto main() -> int
 {
@@ -112,6 +163,18 @@ auto main() -> int
         expect(eq(axis, ori.axis()));
     };
 
+    test("world copy from non-const lvalue") = [] {
+        using N = frame<"N">;
+        using A = frame<"A">;
+
+        auto w = world{orientation<N, A>{0.1, N::z}};
+        auto copy = w;
+        copy.get<N, A>() = orientation<N, A>{0.2, N::z};
+
+        expect(within<1e-15>(0.1, w.get<N, A>().angle()));
+        expect(within<1e-15>(0.2, copy.get<N, A>().angle()));
+    };
+
     test("express vector in world with single chain") = [] {
         using N = frame<"N">;
         using A = frame<"A">;
@@ -163,4 +226,234 @@ auto main() -> int
         expect(within<1e-12>(
             B::position{0., -1., 0.}, A::position{0., 1., 0.}.in<B>(w)));
     };
+
+    test("world renormalizes long composition chains") = [] {
+        using A = unchecked_frame<"A">;
+        using B = unchecked_frame<"B">;
+        using C = unchecked_frame<"C">;
+        using D = unchecked_frame<"D">;
+
+        // rotation of 0.1 about x with a norm error of 1e-4
+        const auto s = 1. + 1e-4;
+        const auto q =
+            turtle::quaternion{s * std::cos(0.05), s * std::sin(0.05), 0., 0.};
+
+        const auto make_world = [&q]<class Root>(Root) {
+            return world{
+                orientation<Root, A>{q},
+                orientation<A, B>{q},
+                orientation<B, C>{q},
+                orientation<C, D>{q},
+            };
+        };
+
+        const auto drifting = make_world(Drifting{}).express<D>();
+        const auto renormalized = make_world(Renormalized{}).express<D>();
+
+        expect(gt(std::abs(1. - drifting.rotation().squared_norm()), 1e-4));
+        expect(lt(std::abs(1. - renormalized.rotation().squared_norm()), 1e-7));
+        expect(within<1e-6>(0.4, renormalized.angle()));
+    };
+
+    test("world composes long chains of checked frames") = [] {
+        constexpr auto links = std::size_t{24};
+        constexpr auto angle = 0.1;
+
+        const auto w = []<std::size_t... Is>(std::index_sequence<Is...>) {
+            return world{orientation<chain<Is>, chain<Is + 1>>{
+                angle, chain<Is>::x}...};
+        }(std::make_index_sequence<links>{});
+
+        const auto ori = w.express<chain<links>>();
+
+        expect(within<1e-12>(links * angle, ori.angle()));
+        expect(within<1e-15>(chain<0>::x, ori.axis()));
+    };
+
+    test("world visits long chains of checked frames") = [] {
+        constexpr auto links = std::size_t{24};
+        constexpr auto angle = 0.1;
+
+        const auto w = []<std::size_t... Is>(std::index_sequence<Is...>) {
+            return world{orientation<sweep<Is>, sweep<Is + 1>>{
+                angle, sweep<Is>::x}...};
+        }(std::make_index_sequence<links>{});
+
+        auto visited = std::size_t{};
+        w.for_each_from_root([&visited](const auto& ori) {
+            ++visited;
+            expect(within<1e-12>(static_cast<double>(visited) * angle,
+                                 ori.angle()));
+        });
+        expect(eq(links, visited));
+    };
+
+    test("world integrates all orientations") = [] {
+        using N = frame<"N">;
+        using A = frame<"A">;
+        using B = frame<"B">;
+        using C = frame<"C">;
+
+        auto w = world{
+            orientation<N, A>{}.with(N::velocity{1., 0., 0.}),
+            orientation<A, B>{0.2, A::y}.with(A::velocity{0., -1., 0.}),
+            orientation<N, C>{},
+        };
+
+        w.integrate(0.1).integrate(0.1);
+
+        expect(within<1e-15>(0.2, w.get<N, A>().angle()));
+        expect(within<1e-15>(N::x, w.get<N, A>().axis()));
+        expect(within<1e-15>(0., w.get<A, B>().angle()));
+        expect(eq(0., w.get<N, C>().angle()));
+    };
+
+    test("world predicts orientations without modification") = [] {
+        using N = frame<"N">;
+        using A = frame<"A">;
+        using B = frame<"B">;
+        using C = frame<"C">;
+
+        const auto w = world{
+            orientation<N, A>{0.1, N::z}.with(N::velocity{0., 0., 1.}),
+            orientation<A, B>{0.2, A::x}.with(A::velocity{2., 0., 0.}),
+            orientation<N, C>{}.with(N::velocity{0., 3., 0.}),
+        };
+
+        auto integrated = w;
+        integrated.integrate(0.1);
+
+        const auto predicted = w.predict<B>(0.1);
+        const auto expected = integrated.express<B>();
+
+        expect(within<1e-15>(expected.angle(), predicted.angle()));
+        expect(within<1e-15>(expected.axis(), predicted.axis()));
+
+        expect(within<1e-15>(0.2, w.predict<A>(0.1).angle()));
+        expect(within<1e-15>(0.4, w.predict<A, B>(0.1).angle()));
+        expect(within<1e-15>(
+            integrated.express<C, B>().rotation().w(),
+            w.predict<C, B>(0.1).rotation().w()));
+
+        expect(eq(0.1, w.get<N, A>().angle()));
+    };
+
+    test("world looks up frames by name and index") = [] {
+        using N = frame<"N">;
+        using A = frame<"A">;
+        using B = frame<"B">;
+        using C = frame<"C">;
+
+        using W = world<meta::tree<N, meta::tree<A, B>, C>,
+                        orientation<N, A>,
+                        orientation<A, B>,
+                        orientation<N, C>>;
+
+        static_assert(W::frame_count == 4);
+        static_assert(W::index_of<N>() == 0);
+        static_assert(W::index_of<C>() == 3);
+        static_assert(W::find("B") == W::index_of<B>());
+        static_assert(not W::find("D"));
+        static_assert(not W::find(""));
+
+        const auto name_of = [](auto f) { return decltype(f)::name; };
+
+        for (auto i = std::size_t{}; i != W::frame_count; ++i) {
+            expect(eq(i, W::find(W::visit_frame(i, name_of)).value()));
+        }
+
+        auto visited = std::string_view{};
+        expect(W::visit_frame("C", [&visited](auto f) {
+            visited = decltype(f)::name;
+        }));
+        expect(eq(std::string_view{"C"}, visited));
+
+        expect(not W::visit_frame("D", [](auto) {}));
+    };
+
+    test("world looks up frames with short names") = [] {
+        using N = frame<"N">;
+        using B = frame<"B">;
+
+        using W1 = decltype(world{orientation<N, B>{}});
+
+        static_assert(W1::find("N") == W1::index_of<N>());
+        static_assert(W1::find("B") == W1::index_of<B>());
+
+        // a chain of frames with two letter names spread over the alphabet
+        constexpr auto step = std::size_t{21};
+        constexpr auto links = std::size_t{31};
+
+        const auto make_world = []<std::size_t... Is>(
+                                    std::index_sequence<Is...>) {
+            return world{orientation<letters<Is * step>,
+                                     letters<(Is + 1) * step>>{}...};
+        };
+        using W2 = decltype(make_world(std::make_index_sequence<links>{}));
+
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (expect(eq(W2::index_of<letters<Is * step>>(),
+                       W2::find(letter_name<Is * step>).value())),
+             ...);
+        }(std::make_index_sequence<links + 1>{});
+        expect(not W2::find("ZZ"));
+    };
+
+    test("perfect hash separates short names") = [] {
+        constexpr auto alphabet =
+            std::string_view{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+
+        for (auto i = std::size_t{}; i != alphabet.size(); ++i) {
+            for (auto j = i + 1; j != alphabet.size(); ++j) {
+                const auto hash = turtle::util::perfect_hash<2>{
+                    {alphabet.substr(i, 1), alphabet.substr(j, 1)}};
+                expect(hash.valid());
+                expect(eq(std::size_t{1}, hash.find(alphabet.substr(j, 1))));
+            }
+        }
+
+        constexpr auto count = alphabet.size() * alphabet.size();
+        auto storage = std::array<std::array<char, 2>, count>{};
+        auto names = std::array<std::string_view, count>{};
+        for (auto i = std::size_t{}; i != count; ++i) {
+            storage[i] = {alphabet[i / alphabet.size()],
+                          alphabet[i % alphabet.size()]};
+            names[i] = {storage[i].data(), storage[i].size()};
+        }
+
+        const auto hash = turtle::util::perfect_hash<count>{names};
+        expect(hash.valid());
+        for (auto i = std::size_t{}; i != count; ++i) {
+            expect(eq(i, hash.find(names[i]).value()));
+        }
+    };
+
+    test("world calculates all angular velocities in one pass") = [] {
+        using N = frame<"N">;
+        using A = frame<"A">;
+        using B = frame<"B">;
+        using C = frame<"C">;
+
+        const auto w = world{
+            orientation<N, A>{0.1, N::z}.with(N::velocity{0., 0., 1.}),
+            orientation<A, B>{0.2, A::x}.with(A::velocity{2., 0., 0.}),
+            orientation<N, C>{0.3, N::y}.with(N::velocity{0., 3., 0.}),
+        };
+
+        using W = std::remove_cvref_t<decltype(w)>;
+
+        const auto in_root = w.angular_velocities();
+        expect(eq(N::velocity{}, in_root[W::index_of<N>()]));
+        expect(within<1e-15>(w.express<B>().angular_velocity(),
+                             in_root[W::index_of<B>()]));
+        expect(within<1e-15>(w.express<C>().angular_velocity(),
+                             in_root[W::index_of<C>()]));
+
+        const auto in_c = w.angular_velocities<C>();
+        expect(within<1e-15>(
+            w.express<B>().angular_velocity().express_in(w.express<C>()),
+            in_c[W::index_of<B>()]));
+        expect(within<1e-15>(turtle::velocity<N, C>{0., 3., 0.},
+                             in_c[W::index_of<C>()]));
+    };
 }
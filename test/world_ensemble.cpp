@@ -0,0 +1,199 @@
+#include "turtle/world_ensemble.hpp"
+
+#include "turtle/checks.hpp"
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/point.hpp"
+#include "turtle/world.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::frame;
+    using turtle::orientation;
+    using turtle::world;
+    using turtle::world_ensemble;
+    using turtle::test::within;
+
+    // composing thousands of perturbed orientations occasionally exceeds the
+    // default unit norm tolerance
+    using N = frame<"N", double, turtle::checks::none>;
+    using A = frame<"A", double, turtle::checks::none>;
+    using B = frame<"B", double, turtle::checks::none>;
+    using C = frame<"C", double, turtle::checks::none>;
+
+    using W = decltype(world{
+        orientation<N, A>{},
+        orientation<A, B>{},
+        orientation<N, C>{},
+    });
+
+    const auto nominal = W{
+        orientation<N, A>{0.1, N::z}.with(N::velocity{0., 0., 1.}),
+        orientation<A, B>{0.2, A::x},
+        orientation<N, C>{0.3, N::y},
+    };
+
+    // perturbs the rotation about A::x of member `i`
+    const auto perturbed = [](world_ensemble<W>& ensemble) {
+        auto ab = ensemble.get<A, B>();
+        for (auto i = std::size_t{}; i != ab.size(); ++i) {
+            ab[i] = orientation<A, B>{1e-4 * static_cast<double>(i), A::x};
+        }
+    };
+
+    test("ensemble members are copies of the nominal world") = [&nominal] {
+        const auto ensemble = world_ensemble<W>{3, nominal};
+
+        expect(eq(std::size_t{3}, ensemble.size()));
+        for (auto i = std::size_t{}; i != ensemble.size(); ++i) {
+            expect(within<1e-15>(
+                0.2, ensemble.member(i).get<A, B>().angle()));
+        }
+    };
+
+    test("ensemble members can be replaced") = [&nominal] {
+        auto ensemble = world_ensemble<W>{3};
+        ensemble.set(1, nominal);
+
+        expect(eq(0., ensemble.member(0).get<N, C>().angle()));
+        expect(within<1e-15>(0.3, ensemble.member(1).get<N, C>().angle()));
+    };
+
+    constexpr auto size = std::size_t{5000};
+
+    test("ensemble expresses every member") = [&] {
+        auto ensemble = world_ensemble<W>{size, nominal};
+        perturbed(ensemble);
+
+        auto out = std::vector<orientation<N, B>>(size);
+        ensemble.express<B>(out, 4);
+
+        auto rel = std::vector<orientation<C, B>>(size);
+        ensemble.express<C, B>(rel, 4);
+
+        for (auto i = std::size_t{}; i < size; i += 97) {
+            const auto w = ensemble.member(i);
+
+            expect(within<1e-15>(w.express<B>().rotation(),
+                                 out[i].rotation()));
+            expect(within<1e-15>(w.express<C, B>().rotation(),
+                                 rel[i].rotation()));
+        }
+    };
+
+    test("ensemble evaluates points in every member") = [&] {
+        auto ensemble = world_ensemble<W>{size, nominal};
+        perturbed(ensemble);
+
+        const auto p = W::point{B::position{1., 2., 3.}};
+
+        auto r = std::vector<N::position>(size);
+        ensemble.position<N>(p, r, 4);
+
+        auto v = std::vector<N::velocity>(size);
+        ensemble.velocity<N>(p, v, 4);
+
+        auto v_c = std::vector<turtle::velocity<N, C>>(size);
+        ensemble.velocity<N, C>(p, v_c, 4);
+
+        auto r_c = std::vector<C::position>(size);
+        ensemble.position<C>(p, r_c, 4);
+
+        for (auto i = std::size_t{}; i < size; i += 97) {
+            const auto w = ensemble.member(i);
+
+            expect(within<1e-15>(p.position<N>(w), r[i]));
+            expect(within<1e-15>(p.velocity<N>(w), v[i]));
+            expect(within<1e-15>(p.velocity<N, C>(w), v_c[i]));
+            expect(within<1e-15>(p.position<C>(w), r_c[i]));
+        }
+    };
+
+    test("ensemble evaluates point velocities with offset origins") = [&] {
+        const auto offset = W{
+            orientation<N, A>{0.1, N::z}
+                .with(N::velocity{0., 0., 1.})
+                .with(N::position{1., 0., 0.}),
+            orientation<A, B>{0.2, A::x}
+                .with(A::velocity{-2., 0., 0.})
+                .with(A::position{0., 2., 0.}),
+            orientation<N, C>{0.3, N::y}.with(N::position{0., 0., 3.}),
+        };
+
+        auto ensemble = world_ensemble<W>{size, offset};
+        auto ab = ensemble.get<A, B>();
+        for (auto i = std::size_t{}; i != ab.size(); ++i) {
+            ab[i] = orientation<A, B>{1e-4 * static_cast<double>(i), A::x}
+                        .with(A::velocity{-2., 0., 0.})
+                        .with(A::position{0., 2., 0.});
+        }
+
+        const auto p = W::point{B::position{1., 2., 3.}, B::velocity{}};
+
+        auto v = std::vector<N::velocity>(size);
+        ensemble.velocity<N>(p, v, 4);
+
+        auto v_a = std::vector<turtle::velocity<A, C>>(size);
+        ensemble.velocity<A, C>(p, v_a, 4);
+
+        for (auto i = std::size_t{}; i < size; i += 97) {
+            const auto w = ensemble.member(i);
+
+            expect(within<1e-15>(p.velocity<N>(w), v[i]));
+            expect(within<1e-15>(p.velocity<A, C>(w), v_a[i]));
+        }
+
+        constexpr auto h = 1e-6;
+        auto plus = ensemble.member(size - 1);
+        auto minus = plus;
+        plus.integrate(h);
+        minus.integrate(-h);
+
+        const auto d = (p.position<N>(plus) - p.position<N>(minus)) / (2 * h);
+        expect(within<1e-8>(N::velocity{d.x(), d.y(), d.z()}, v.back()));
+    };
+
+    test("parallel chunks rethrow after joining every thread") = [] {
+        using turtle::detail::parallel_chunks;
+
+        for (const auto throwing : {std::size_t{}, std::size_t{2048}}) {
+            auto visited = std::vector<int>(4096);
+
+            expect(throws<std::runtime_error>([&] {
+                parallel_chunks(4096, 4, 1024, [&](auto first, auto last) {
+                    for (auto i = first; i != last; ++i) {
+                        visited[i] = 1;
+                    }
+                    if (first == throwing) {
+                        throw std::runtime_error{"chunk"};
+                    }
+                });
+            }));
+            expect(eq(4096L, std::count(visited.begin(), visited.end(), 1)));
+        }
+    };
+
+    test("ensemble evaluation is independent of thread count") = [&] {
+        auto ensemble = world_ensemble<W>{size, nominal};
+        perturbed(ensemble);
+
+        auto serial = std::vector<orientation<C, B>>(size);
+        ensemble.express<C, B>(serial, 1);
+
+        auto parallel = std::vector<orientation<C, B>>(size);
+        ensemble.express<C, B>(parallel);
+
+        for (auto i = std::size_t{}; i != size; ++i) {
+            expect(eq(serial[i].rotation(), parallel[i].rotation()));
+        }
+    };
+}
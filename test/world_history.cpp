@@ -0,0 +1,127 @@
+#include "turtle/world_history.hpp"
+
+#include "turtle/frame.hpp"
+#include "turtle/orientation.hpp"
+#include "turtle/world.hpp"
+#include "test/util/within.hpp"
+
+#include "boost/ut.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+auto main() -> int
+{
+    using namespace boost::ut;
+    using turtle::frame;
+    using turtle::orientation;
+    using turtle::world;
+    using turtle::world_history;
+    using turtle::test::within;
+
+    using N = frame<"N">;
+    using A = frame<"A">;
+    using B = frame<"B">;
+
+    using W = decltype(world{orientation<N, A>{}, orientation<A, B>{}});
+
+    // world rotated about N::z by `angle` between N and A and by `angle` about
+    // A::x between A and B
+    const auto make_world = [](double angle) {
+        return W{
+            orientation<N, A>{angle, N::z},
+            orientation<A, B>{angle, A::x},
+        };
+    };
+
+    test("empty history has no orientation") = [] {
+        const auto h = world_history<W, 4>{};
+
+        expect(h.empty());
+        expect(eq(std::size_t{4}, h.capacity()));
+        expect(not h.express<A>(0.).has_value());
+        expect(not h.express<A, B>(0.).has_value());
+    };
+
+    test("history interpolates between snapshots") = [&make_world] {
+        auto h = world_history<W, 4>{};
+        h.push(1., make_world(0.2));
+        h.push(2., make_world(0.6));
+
+        expect(eq(std::size_t{2}, h.size()));
+
+        expect(within<1e-15>(0.2, h.express<A>(1.)->angle()));
+        expect(within<1e-15>(0.3, h.express<A>(1.25)->angle()));
+        expect(within<1e-15>(N::z, h.express<A>(1.25)->axis()));
+
+        expect(within<1e-15>(0.5, h.express<A, B>(1.75)->angle()));
+        expect(within<1e-15>(A::x, h.express<A, B>(1.75)->axis()));
+    };
+
+    test("history matches world at snapshot times") = [&make_world] {
+        auto h = world_history<W, 4>{};
+        h.push(0., make_world(0.1));
+        h.push(1., make_world(0.4));
+        h.push(2., make_world(0.9));
+
+        const auto expected = make_world(0.4).express<N, B>();
+        const auto actual = *h.express<N, B>(1.);
+
+        expect(within<1e-15>(expected.rotation(), actual.rotation()));
+    };
+
+    test("history clamps queries outside of stored times") = [&make_world] {
+        auto h = world_history<W, 4>{};
+        h.push(1., make_world(0.2));
+        h.push(2., make_world(0.6));
+
+        expect(within<1e-15>(0.2, h.express<A>(-5.)->angle()));
+        expect(within<1e-15>(0.6, h.express<A>(2.)->angle()));
+        expect(within<1e-15>(0.6, h.express<A>(5.)->angle()));
+    };
+
+    test("history replaces oldest snapshots when full") = [&make_world] {
+        auto h = world_history<W, 3>{};
+        for (auto i = 0; i != 10; ++i) {
+            h.push(i, make_world(0.1 * i));
+        }
+
+        expect(eq(std::size_t{3}, h.size()));
+
+        expect(within<1e-15>(0.7, h.express<A>(0.)->angle()));
+        expect(within<1e-15>(0.75, h.express<A>(7.5)->angle()));
+        expect(within<1e-15>(0.85, h.express<A>(8.5)->angle()));
+        expect(within<1e-15>(0.9, h.express<A>(9.)->angle()));
+    };
+
+    test("history readers run concurrently with a writer") = [&make_world] {
+        auto h = world_history<W, 8>{};
+        h.push(0., make_world(0.));
+
+        constexpr auto pushes = 20'000;
+        auto done = std::atomic<bool>{};
+        auto failures = 0;
+
+        auto reader = std::thread{[&h, &done, &failures] {
+            auto reads = 0;
+            while (not done.load(std::memory_order_acquire)) {
+                const auto ori = h.express<A>(1e-3 * reads);
+                if (not ori or
+                    std::abs(1. - ori->rotation().squared_norm()) > 1e-12) {
+                    ++failures;
+                }
+                ++reads;
+            }
+        }};
+
+        for (auto i = 1; i != pushes; ++i) {
+            h.push(i, make_world(std::fmod(1e-3 * i, 1.)));
+        }
+        done.store(true, std::memory_order_release);
+        reader.join();
+
+        expect(eq(0, failures));
+        expect(eq(std::size_t{8}, h.size()));
+    };
+}